@@ -88,15 +88,19 @@ constexpr std::size_t count_adjacent_if2(
 /*! has_duplicates: using std::map, counts the occurrence of the particular
  * elements in the container and...\n
  *
+ * @tparam alloc : allocator for the nodes of the internal std::set<>\n
+ 						....std::allocator<>() by default
  * @return  : true.... duplicates exists
  *            false... if not
  */
-template <typename Iterator>
-inline constexpr bool has_duplicates(Iterator beginIter, const Iterator endIter)
+template <typename Iterator,
+	typename Allocator = std::allocator<typename std::iterator_traits<Iterator>::value_type>>
+inline constexpr bool has_duplicates(Iterator beginIter, const Iterator endIter,
+	const Allocator& alloc = {})
 {
 	if (beginIter == endIter) return false; // edge case
 	using Type = typename std::iterator_traits<Iterator>::value_type;
-	std::set<Type> set;
+	std::set<Type, std::less<Type>, Allocator> set(alloc);
 	for (; beginIter != endIter; ++beginIter)
 	{
 		if(const auto& [iter, successInsertion] = set.emplace(*beginIter);
@@ -0,0 +1,349 @@
+/******************************************************************************
+ * BehaviorSignal - Signal which keeps the arguments of its latest emission:
+ * a slot connecting late gets them immediately (on the connecting thread),
+ * and latest() reads them without subscribing.
+ *
+ * Trivially copyable arguments live in a seqlock: latest() never blocks the
+ * emitters and takes no lock (it retries while an emission stores new ones).
+ * Other arguments (e.g. std::string) are kept under a SlimLock instead, as
+ * reading them while they are written is not safe.
+ *
+ * The emissions and connect() with its replay take turns (one lock, which a
+ * slot may take again: it can emit / connect on its thread). A slot connecting
+ * late gets the latest arguments before any newer emission reaches it, and
+ * the slots get the emissions in the order latest() sees them (but for
+ * emissions nested in a slot, which run before the outer one has reached all
+ * the slots); emitting from several threads serialises the emitters.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_BEHAVIOR_SIGNAL_T_HPP
+#define JEJO_BEHAVIOR_SIGNAL_T_HPP
+
+ // C++ headers
+#include <array>		// std::array<>
+#include <atomic>		// std::atomic<>
+#include <bit>			// std::bit_cast<>()
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint64_t
+#include <cstring>		// std::memcpy()
+#include <memory>		// std::shared_ptr<>
+#include <optional>		// std::optional<>
+#include <thread>		// std::this_thread::yield(), std::thread::id
+#include <tuple>		// std::tuple<>, std::apply()
+#include <type_traits>	// std::conditional_t<>, std::decay_t<>
+#include <utility>		// std::index_sequence<>
+
+// own JeJo-lib headers
+#include "SignalsT.hpp"
+
+namespace JeJo
+{
+	namespace internal
+	{
+		// Values of trivially copyable types behind a seqlock: the sequence is
+		// odd while a writer stores, 0 until the first store. The values are
+		// copied in and out of atomic words (no data race with the readers).
+		template<typename... Types>
+		class SeqLockStorage final
+		{
+		private:
+			static constexpr std::size_t bytes = (std::size_t{ 0u } + ... + sizeof(Types));
+			static constexpr std::size_t words = bytes ? (bytes + 7u) / 8u : 1u;
+
+			// Offset of each value in the words
+			static constexpr std::array<std::size_t, sizeof...(Types) + 1u> offsets = [] {
+				std::array<std::size_t, sizeof...(Types) + 1u> result{};
+				const std::size_t sizes[]{ sizeof(Types)..., 0u };
+				for (std::size_t index = 0u; index < sizeof...(Types); ++index)
+				{
+					result[index + 1u] = result[index] + sizes[index];
+				}
+				return result;
+			}();
+
+			std::atomic<std::uint64_t> m_sequence{ 0u };
+			std::array<std::atomic<std::uint64_t>, words> m_words{};
+
+			// Value at the index, out of a copy of the words
+			template<std::size_t Index, typename Type>
+			static Type value(const unsigned char* buffer) noexcept
+			{
+				std::array<unsigned char, sizeof(Type)> raw;
+				std::memcpy(raw.data(), buffer + offsets[Index], sizeof(Type));
+				return std::bit_cast<Type>(raw);
+			}
+
+			// Tuple of the values, out of a copy of the words
+			template<std::size_t... Index>
+			static std::tuple<Types...> values(const unsigned char* buffer, std::index_sequence<Index...>) noexcept
+			{
+				return std::tuple<Types...>{ value<Index, Types>(buffer)... };
+			}
+
+		public:
+			// Store the values; the writers take turns
+			void store(const Types&... values) noexcept
+			{
+				std::uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+				while ((sequence & 1u) || !m_sequence.compare_exchange_weak(sequence, sequence + 1u, std::memory_order_acquire))
+				{
+					if (sequence & 1u)
+					{
+						std::this_thread::yield();
+						sequence = m_sequence.load(std::memory_order_relaxed);
+					}
+				}
+
+				std::array<std::uint64_t, words> buffer{};
+				std::size_t index = 0u;
+				((std::memcpy(reinterpret_cast<unsigned char*>(buffer.data()) + offsets[index++], &values, sizeof(Types))), ...);
+				for (std::size_t word = 0u; word < words; ++word)
+				{
+					// release: a reader seeing a new word sees the odd sequence
+					m_words[word].store(buffer[word], std::memory_order_release);
+				}
+				m_sequence.store(sequence + 2u, std::memory_order_release);
+			}
+
+			// Load the values, none before the first store
+			std::optional<std::tuple<Types...>> load() const noexcept
+			{
+				std::array<std::uint64_t, words> buffer;
+				std::uint64_t sequence = 0u;
+				do
+				{
+					sequence = m_sequence.load(std::memory_order_acquire);
+					while (sequence & 1u)
+					{
+						std::this_thread::yield();
+						sequence = m_sequence.load(std::memory_order_acquire);
+					}
+					for (std::size_t word = 0u; word < words; ++word)
+					{
+						buffer[word] = m_words[word].load(std::memory_order_acquire);
+					}
+				} while (m_sequence.load(std::memory_order_relaxed) != sequence);
+
+				if (!sequence)
+				{
+					return std::nullopt;
+				}
+				return values(reinterpret_cast<const unsigned char*>(buffer.data()), std::index_sequence_for<Types...>{});
+			}
+		};
+
+		// Values of any copyable types under a SlimLock
+		template<typename... Types>
+		class LockedStorage final
+		{
+		private:
+			mutable SlimLock m_lock{};
+			std::optional<std::tuple<Types...>> m_values{};
+
+		public:
+			// Store the values
+			// May throw exception if copying the values does
+			void store(const Types&... values)
+			{
+				const AutoLock guard{ m_lock };
+				m_values.emplace(values...);
+			}
+
+			// Load the values, none before the first store
+			// May throw exception if copying the values does
+			std::optional<std::tuple<Types...>> load() const
+			{
+				const AutoLock guard{ m_lock };
+				return m_values;
+			}
+		};
+	}
+
+	// TEMPLATE CLASS BehaviorSignal
+	template<typename ReType, typename... Args> class BehaviorSignal;
+
+	template<typename ReType, typename... Args> class BehaviorSignal<ReType(Args...)> final
+	{
+	public:
+		using size_type = std::size_t;
+		using ValuesType = std::tuple<std::decay_t<Args>...>;
+
+	private:
+		using SlotType = internal::Slot<ReType(Args...)>;
+		using StorageType = std::conditional_t<(std::is_trivially_copyable_v<std::decay_t<Args>> && ...)
+			, internal::SeqLockStorage<std::decay_t<Args>...>, internal::LockedStorage<std::decay_t<Args>...>>;
+
+		Signal<ReType(Args...)> m_signal;
+		StorageType m_latest;
+		internal::SlimLock m_order_lock;				// emissions, connect() + replay: in turn
+		std::atomic<std::thread::id> m_owner;		// thread holding m_order_lock
+
+		// Hold m_order_lock for the scope, unless the thread holds it already
+		class OrderGuard final
+		{
+		private:
+			BehaviorSignal& m_behavior;
+			bool m_locked;
+
+		public:
+			// Construct OrderGuard
+			explicit OrderGuard(BehaviorSignal& behavior) noexcept
+				: m_behavior{ behavior }
+				, m_locked{ behavior.m_owner.load(std::memory_order_relaxed) != std::this_thread::get_id() }
+			{
+				if (m_locked)
+				{
+					m_behavior.m_order_lock.lock();
+					m_behavior.m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+				}
+			}
+
+			// Deleted copy-constructor
+			OrderGuard(const OrderGuard&) = delete;
+
+			// Deleted copy-assignment operator
+			OrderGuard& operator=(const OrderGuard&) = delete;
+
+			// Destroy OrderGuard
+			~OrderGuard() noexcept
+			{
+				if (m_locked)
+				{
+					m_behavior.m_owner.store(std::thread::id{}, std::memory_order_relaxed);
+					m_behavior.m_order_lock.unlock();
+				}
+			}
+		};
+
+		// Slot of the connect() arguments: free function / static method
+		static SlotType slot(ReType(*function)(Args...)) noexcept
+		{
+			return SlotType(function);
+		}
+
+		// Slot of the connect() arguments: method
+		template<typename ClassType, typename FunctionPtrType>
+		static SlotType slot(ClassType* object, FunctionPtrType method) noexcept
+		{
+			return SlotType(object, method);
+		}
+
+		// Slot of the connect() arguments: tracked method
+		template<typename ClassType, typename FunctionPtrType>
+		static SlotType slot(const std::shared_ptr<ClassType>& object, FunctionPtrType method) noexcept
+		{
+			return SlotType(object.get(), method);
+		}
+
+		// Slot of the connect() arguments: functor
+		template<typename ClassType>
+		static SlotType slot(ClassType* functor) noexcept
+		{
+			return SlotType(functor);
+		}
+
+		// Slot of the connect() arguments: tracked functor
+		template<typename ClassType>
+		static SlotType slot(const std::shared_ptr<ClassType>& functor) noexcept
+		{
+			return SlotType(functor.get());
+		}
+
+	public:
+		// Construct BehaviorSignal with provided / default capacity
+		// May throw exception if memory allocation fails
+		explicit BehaviorSignal(size_type capacity = 5)
+			: m_signal{ capacity }
+			, m_latest{}
+			, m_order_lock{}
+			, m_owner{}
+		{}
+
+		// Deleted copy-constructor
+		BehaviorSignal(const BehaviorSignal&) = delete;
+
+		// Deleted copy-assignment operator
+		BehaviorSignal& operator=(const BehaviorSignal&) = delete;
+
+		// Emit BehaviorSignal: keep the arguments, then emit them
+		// May throw exception if some slot does
+		void emit(Args... args)
+		{
+			const OrderGuard guard{ *this };
+			m_latest.store(args...);
+			m_signal(args...);
+		}
+
+		// Emit BehaviorSignal: keep the arguments, then emit them
+		// May throw exception if some slot does
+		void operator()(Args... args)
+		{
+			const OrderGuard guard{ *this };
+			m_latest.store(args...);
+			m_signal(args...);
+		}
+
+		// Arguments of the latest emission, none before the first one
+		// May throw exception if copying the (not trivially copyable) arguments does
+		std::optional<ValuesType> latest() const
+		{
+			return m_latest.load();
+		}
+
+		// Connect a slot (the arguments of Signal::connect()) and call it with
+		// the arguments of the latest emission, if any, before a newer emission
+		// reaches it. Returns false (and makes no call) if the slot is connected
+		// already.
+		// May throw exception if memory allocation / the slot does
+		template<typename... Targets>
+		bool connect(const Targets&... targets)
+		{
+			const OrderGuard guard{ *this };
+			if (!m_signal.connect(targets...))
+			{
+				return false;
+			}
+
+			if (std::optional<ValuesType> values = m_latest.load())
+			{
+				const SlotType target = slot(targets...);
+				std::apply([&target](auto&... args) { target(args...); }, *values);
+			}
+			return true;
+		}
+
+		// Disconnect a slot; see Signal::disconnect()
+		template<typename... Targets>
+		bool disconnect(Targets&&... targets) noexcept
+		{
+			return m_signal.disconnect(std::forward<Targets>(targets)...);
+		}
+
+		// Check whether a slot is connected; see Signal::connected()
+		template<typename... Targets>
+		bool connected(Targets&&... targets) const noexcept
+		{
+			return m_signal.connected(std::forward<Targets>(targets)...);
+		}
+
+		// Get number of connected slots
+		size_type size() const noexcept
+		{
+			return m_signal.size();
+		}
+
+		// Check whether list of connected slots is empty
+		bool empty() const noexcept
+		{
+			return m_signal.empty();
+		}
+	};
+}
+
+#endif // JEJO_BEHAVIOR_SIGNAL_T_HPP
+
+/*****************************************************************************/
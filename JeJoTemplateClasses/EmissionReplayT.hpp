@@ -0,0 +1,180 @@
+/******************************************************************************
+ * EmissionReplay - Replay driver for the traces of EmissionTrace: re-emits
+ * the recorded emissions against Signals bound to the recorded signal ids,
+ * at the original pace or at maximum speed, and reports the throughput and
+ * the latency of the emissions (and, at the original pace, how far behind
+ * schedule the replay fell).
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_EMISSION_REPLAY_T_HPP
+#define JEJO_EMISSION_REPLAY_T_HPP
+
+ // C++ headers
+#include <algorithm>	// std::nth_element(), std::max_element()
+#include <chrono>		// std::chrono::microseconds
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint32_t, std::uint64_t
+#include <cstring>		// std::memcpy()
+#include <ostream>		// std::ostream
+#include <thread>		// std::this_thread::sleep_for()
+#include <tuple>		// std::tuple<>, std::get<>()
+#include <type_traits>	// std::decay_t<>
+#include <utility>		// std::index_sequence<>
+#include <vector>		// std::vector<>
+
+// own JeJo-lib headers
+#include "SignalsT.hpp"
+#include "EmissionTraceT.hpp"
+
+#if JEJO_HAS_MMAP
+namespace JeJo
+{
+	// Pace of a replay
+	enum class ReplaySpeed : char { Original = 1, Maximum = 2 };
+
+	// Result of a replay
+	struct ReplayStats final
+	{
+		std::size_t mEmissions{ 0u };
+		std::size_t mSkipped{ 0u };			// records of unbound ids / other signatures
+		double mSeconds{ 0.0 };
+		double mThroughput{ 0.0 };			// emissions per second
+		std::uint64_t mLatencyMeanNs{ 0u };
+		std::uint64_t mLatencyP50Ns{ 0u };
+		std::uint64_t mLatencyP99Ns{ 0u };
+		std::uint64_t mLatencyMaxNs{ 0u };
+		std::uint64_t mMaxLagNs{ 0u };		// original pace: the most behind schedule
+	};
+
+	// Print ReplayStats
+	inline std::ostream& operator<<(std::ostream& out, const ReplayStats& stats)
+	{
+		return out << stats.mEmissions << " emissions (" << stats.mSkipped << " skipped) in "
+			<< stats.mSeconds << " s: " << stats.mThroughput << " /s, latency mean "
+			<< stats.mLatencyMeanNs << " ns, p50 " << stats.mLatencyP50Ns << " ns, p99 "
+			<< stats.mLatencyP99Ns << " ns, max " << stats.mLatencyMaxNs << " ns, max lag "
+			<< stats.mMaxLagNs << " ns";
+	}
+
+	class EmissionReplay final
+	{
+	private:
+		// Signal bound to a recorded id
+		struct Binding final
+		{
+			std::uint32_t mSignal;
+			std::uint32_t mSize;
+			void* mTarget;
+			void (*mEmit)(void*, const unsigned char*);
+		};
+
+		std::vector<Binding> m_bindings;
+
+		// Copy the arguments out of a payload and emit them
+		template<typename SignalType, typename... Args, std::size_t... Index>
+		static void emit(SignalType& signal, const unsigned char* payload, std::index_sequence<Index...>)
+		{
+			std::tuple<std::decay_t<Args>...> args{};
+			std::size_t offset = 0u;
+			((std::memcpy(&std::get<Index>(args), payload + offset, sizeof(Args)), offset += sizeof(Args)), ...);
+			signal(std::get<Index>(args)...);
+		}
+
+		// Binding of a recorded id
+		const Binding* find(std::uint32_t signal) const noexcept
+		{
+			for (const Binding& binding : m_bindings)
+			{
+				if (binding.mSignal == signal)
+				{
+					return &binding;
+				}
+			}
+			return nullptr;
+		}
+
+	public:
+		// Re-emit the records of the id against the Signal, which must outlive the replay.
+		// May throw exception if memory allocation fails
+		template<typename ReType, typename... Args>
+		void bind(std::uint32_t id, Signal<ReType(Args...)>& signal)
+		{
+			using SignalType = Signal<ReType(Args...)>;
+			m_bindings.push_back(Binding{ id, static_cast<std::uint32_t>((std::size_t{ 0u } + ... + sizeof(Args))), &signal
+				, [](void* target, const unsigned char* payload) {
+					emit<SignalType, Args...>(*static_cast<SignalType*>(target), payload, std::index_sequence_for<Args...>{});
+				} });
+		}
+
+		// Replay the trace.
+		// May throw exception if some slot does / memory allocation fails
+		ReplayStats run(const EmissionTraceReader& trace, ReplaySpeed speed = ReplaySpeed::Maximum) const
+		{
+			ReplayStats stats;
+			std::vector<std::uint64_t> latencies;
+			latencies.reserve(trace.records());
+
+			const std::uint64_t start = internal::trace_now_ns();
+			trace.for_each([&](const TraceRecord& record) {
+				const Binding* const binding = find(record.mSignal);
+				if (!binding || binding->mSize != record.mSize)
+				{
+					++stats.mSkipped;
+					return;
+				}
+
+				std::uint64_t now = internal::trace_now_ns();
+				if (speed == ReplaySpeed::Original)
+				{
+					const std::uint64_t due = start + record.mTimeNs;
+					while (now < due)
+					{
+						// sleep if far ahead, spin for the last stretch
+						if (due - now > 100'000u)
+						{
+							std::this_thread::sleep_for(std::chrono::microseconds((due - now) / 2'000u));
+						}
+						now = internal::trace_now_ns();
+					}
+					stats.mMaxLagNs = std::max(stats.mMaxLagNs, now - due);
+				}
+
+				binding->mEmit(binding->mTarget, record.mPayload);
+				latencies.push_back(internal::trace_now_ns() - now);
+			});
+			const std::uint64_t elapsed = internal::trace_now_ns() - start;
+
+			stats.mEmissions = latencies.size();
+			stats.mSeconds = static_cast<double>(elapsed) * 1e-9;
+			stats.mThroughput = elapsed ? static_cast<double>(stats.mEmissions) * 1e9 / static_cast<double>(elapsed) : 0.0;
+			if (!latencies.empty())
+			{
+				std::uint64_t total = 0u;
+				for (const std::uint64_t latency : latencies)
+				{
+					total += latency;
+				}
+				stats.mLatencyMeanNs = total / latencies.size();
+				stats.mLatencyMaxNs = *std::max_element(latencies.begin(), latencies.end());
+
+				const auto percentile = [&latencies](std::size_t percent) {
+					const auto nth = latencies.begin() + static_cast<std::ptrdiff_t>((latencies.size() - 1u) * percent / 100u);
+					std::nth_element(latencies.begin(), nth, latencies.end());
+					return *nth;
+				};
+				stats.mLatencyP50Ns = percentile(50u);
+				stats.mLatencyP99Ns = percentile(99u);
+			}
+			return stats;
+		}
+	};
+}
+#endif // JEJO_HAS_MMAP
+
+#endif // JEJO_EMISSION_REPLAY_T_HPP
+
+/*****************************************************************************/
@@ -0,0 +1,453 @@
+/******************************************************************************
+ * EmissionTrace - Compact binary log of Signal emissions, written through a
+ * memory-mapped file: a Signal recording into it (Signal::record()) appends
+ * one record per emission (timestamp, signal id, trivially copyable
+ * arguments) with one timestamp read and a few stores into a chunk of the
+ * file owned by the emitting thread; no atomic operation (but one per chunk),
+ * syscall, lock or allocation. A thread keeps one chunk for each of the
+ * (up to 8) traces it records into in turn.
+ *
+ * EmissionTraceReader maps a trace file for reading; EmissionReplay
+ * (EmissionReplayT.hpp) re-emits it against Signals.
+ *
+ * File layout: TraceHeader, then the chunks of records, each record a
+ * TraceRecordHeader and the arguments one after the other, padded to 8 bytes;
+ * a padding record covers the unused end of a chunk. The chunks of the
+ * threads interleave: the reader orders the records by time. Timestamps are CPU
+ * ticks (rdtsc) where available, converted to nanoseconds with the start /
+ * end times written into the header. A full trace drops further records
+ * (counted in dropped()).
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_EMISSION_TRACE_T_HPP
+#define JEJO_EMISSION_TRACE_T_HPP
+
+ // C++ headers
+#include <algorithm>	// std::min(), std::max(), std::stable_sort()
+#include <array>		// std::array<>
+#include <atomic>		// std::atomic<>
+#include <cerrno>		// errno
+#include <chrono>		// std::chrono::steady_clock
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint32_t, std::uint64_t
+#include <cstring>		// std::memcpy()
+#include <string>		// std::string
+#include <system_error>	// std::system_error
+#include <vector>		// std::vector<>
+
+// own JeJo-lib headers
+#include "MmapArenaT.hpp"	// JEJO_HAS_MMAP
+
+#if JEJO_HAS_MMAP
+#include <fcntl.h>		// open(), O_CREAT, O_RDWR
+#include <sys/mman.h>	// mmap(), munmap()
+#include <sys/stat.h>	// fstat()
+#include <unistd.h>		// ftruncate(), close(), sysconf()
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>	// __rdtsc()
+#endif
+
+namespace JeJo
+{
+	namespace internal
+	{
+		// Header of a trace file
+		struct TraceHeader final
+		{
+			std::uint64_t mMagic;
+			std::uint64_t mBytes;		// bytes of records
+			std::uint64_t mRecords;
+			std::uint64_t mDropped;
+			std::uint64_t mStartTicks;
+			std::uint64_t mEndTicks;
+			std::uint64_t mStartNs;		// steady clock at mStartTicks
+			std::uint64_t mEndNs;		// steady clock at mEndTicks
+		};
+
+		// Header of a record
+		struct TraceRecordHeader final
+		{
+			std::uint64_t mTicks;
+			std::uint32_t mSignal;
+			std::uint32_t mSize;		// bytes of arguments
+		};
+
+		inline constexpr std::uint64_t trace_magic = 0x31454341524A454Aull; // "JEJRACE1"
+
+		// Bytes of a record with the arguments, padded to 8
+		inline constexpr std::size_t trace_record_size(std::size_t payload) noexcept
+		{
+			return sizeof(TraceRecordHeader) + (payload + 7u) / 8u * 8u;
+		}
+
+		// Timestamp of a record
+		inline std::uint64_t trace_ticks() noexcept
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#else
+			return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+		}
+
+		// Signal id of the padding records (unused end of a chunk)
+		inline constexpr std::uint32_t trace_padding = 0xFFFFFFFFu;
+
+		// Bytes of the file reserved by a thread at once
+		inline constexpr std::size_t trace_chunk_size = std::size_t{ 64u } << 10u;
+
+		// Serial numbers of the traces, identify them in the chunks of the threads
+		inline std::atomic<std::uint64_t> trace_serial{ 0u };
+
+		// Chunk of a trace being filled by the thread
+		struct TraceChunk final
+		{
+			std::uint64_t mTrace{ 0u };
+			unsigned char* mNext{ nullptr };
+			unsigned char* mEnd{ nullptr };
+		};
+
+		inline constexpr std::size_t trace_chunk_slots = 8u;	// chunks per thread, a power of two
+
+		// Chunks of the thread, direct-mapped by trace serial: a thread recording
+		// into up to trace_chunk_slots traces in turn keeps one chunk per trace.
+		// Traces colliding in it waste the rest of the chunk they evict.
+		inline thread_local std::array<TraceChunk, trace_chunk_slots> trace_chunks{};
+
+		// Write a padding record over [begin, end)
+		inline void trace_pad(unsigned char* begin, const unsigned char* end) noexcept
+		{
+			const TraceRecordHeader padding{ 0u, trace_padding
+				, static_cast<std::uint32_t>(static_cast<std::size_t>(end - begin) - sizeof(TraceRecordHeader)) };
+			std::memcpy(begin, &padding, sizeof(padding));
+		}
+
+		// Steady clock, in nanoseconds
+		inline std::uint64_t trace_now_ns() noexcept
+		{
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+	}
+
+	class EmissionTrace;
+
+#if JEJO_HAS_MMAP
+	class EmissionTrace final
+	{
+	public:
+		using size_type = std::size_t;
+
+	private:
+		unsigned char* mp_mapping;
+		size_type m_capacity;		// bytes for records
+		size_type m_chunk_size;
+		const std::uint64_t m_serial;
+		int m_fd;
+		alignas(64) std::atomic<size_type> m_used;
+		std::atomic<size_type> m_end;		// end of the chunks, once a chunk is refused
+		std::atomic<size_type> m_dropped;
+
+		// Header at the start of the file
+		internal::TraceHeader& header() const noexcept
+		{
+			return *reinterpret_cast<internal::TraceHeader*>(mp_mapping);
+		}
+
+		// Reserve a new chunk for the thread, with room for a record of bytes
+		bool refill(internal::TraceChunk& chunk, size_type bytes) noexcept
+		{
+			const size_type size = std::max(m_chunk_size, bytes + sizeof(internal::TraceRecordHeader));
+			const size_type offset = m_used.fetch_add(size, std::memory_order_relaxed);
+			if (offset + size > m_capacity)
+			{
+				// the chunks end at the first one refused
+				size_type end = m_end.load(std::memory_order_relaxed);
+				while (offset < end && !m_end.compare_exchange_weak(end, offset, std::memory_order_relaxed))
+				{
+				}
+				chunk = internal::TraceChunk{};
+				return false;
+			}
+
+			unsigned char* const begin = mp_mapping + sizeof(internal::TraceHeader) + offset;
+			chunk = internal::TraceChunk{ m_serial, begin, begin + size };
+			internal::trace_pad(chunk.mNext, chunk.mEnd);
+			return true;
+		}
+
+	public:
+		// Create (truncate) the trace file, with room for capacity bytes of records.
+		// Prefaulting writes every page once here, so that the first write of the
+		// emissions to a page does not fault (about 20 ns per record otherwise).
+		// Throws std::system_error if the file cannot be created / mapped
+		explicit EmissionTrace(const std::string& path, size_type capacity = size_type{ 64u } << 20u, bool prefault = true)
+			: mp_mapping{ nullptr }
+			, m_capacity{ (capacity + 7u) / 8u * 8u }
+			, m_chunk_size{ std::min(internal::trace_chunk_size, m_capacity / 64u * 8u) }
+			, m_serial{ ++internal::trace_serial }
+			, m_fd{ ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644) }
+			, m_used{ 0u }
+			, m_end{ m_capacity }
+			, m_dropped{ 0u }
+		{
+			if (m_fd < 0)
+			{
+				throw std::system_error(errno, std::generic_category(), "open");
+			}
+			const size_type size = sizeof(internal::TraceHeader) + m_capacity;
+			void* mapping = MAP_FAILED;
+			if (::ftruncate(m_fd, static_cast<off_t>(size)) == 0)
+			{
+				mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+			}
+			if (mapping == MAP_FAILED)
+			{
+				const int error = errno;
+				::close(m_fd);
+				throw std::system_error(error, std::generic_category(), "mmap");
+			}
+
+			mp_mapping = static_cast<unsigned char*>(mapping);
+			if (prefault)
+			{
+				const long page = ::sysconf(_SC_PAGESIZE);
+				for (size_type offset = 0u; offset < size; offset += page > 0 ? static_cast<size_type>(page) : 4096u)
+				{
+					*static_cast<volatile unsigned char*>(mp_mapping + offset) = 0u;
+				}
+			}
+			header() = internal::TraceHeader{ internal::trace_magic, 0u, 0u, 0u
+				, internal::trace_ticks(), 0u, internal::trace_now_ns(), 0u };
+		}
+
+		// Deleted copy-constructor
+		EmissionTrace(const EmissionTrace&) = delete;
+
+		// Deleted copy-assignment operator
+		EmissionTrace& operator=(const EmissionTrace&) = delete;
+
+		// Destroy EmissionTrace: complete the header and cut the file to the records.
+		// No Signal may be recording into it anymore.
+		~EmissionTrace() noexcept
+		{
+			const size_type used = m_used.load() < m_end.load() ? m_used.load() : m_end.load();
+			internal::TraceHeader& head = header();
+			head.mBytes = used;
+			head.mRecords = 0u;
+			for (size_type offset = 0u; offset < used; )
+			{
+				internal::TraceRecordHeader record;
+				std::memcpy(&record, mp_mapping + sizeof(internal::TraceHeader) + offset, sizeof(record));
+				head.mRecords += record.mSignal != internal::trace_padding;
+				offset += internal::trace_record_size(record.mSize);
+			}
+			head.mDropped = m_dropped.load();
+			head.mEndTicks = internal::trace_ticks();
+			head.mEndNs = internal::trace_now_ns();
+
+			::munmap(mp_mapping, sizeof(internal::TraceHeader) + m_capacity);
+			static_cast<void>(::ftruncate(m_fd, static_cast<off_t>(sizeof(internal::TraceHeader) + used)));
+			::close(m_fd);
+		}
+
+		// Append a record into the chunk of the thread; thread safe.
+		// Drops it if the trace is full.
+		template<typename... Args>
+		void append(std::uint32_t signal, const Args&... args) noexcept
+		{
+			constexpr size_type payload = (size_type{ 0u } + ... + sizeof(Args));
+			constexpr size_type bytes = internal::trace_record_size(payload);
+
+			// room for the record and the padding after it
+			internal::TraceChunk& chunk = internal::trace_chunks[m_serial & (internal::trace_chunk_slots - 1u)];
+			if (chunk.mTrace != m_serial
+				|| static_cast<size_type>(chunk.mEnd - chunk.mNext) < bytes + sizeof(internal::TraceRecordHeader))
+			{
+				if (!refill(chunk, bytes))
+				{
+					m_dropped.fetch_add(1u, std::memory_order_relaxed);
+					return;
+				}
+			}
+
+			unsigned char* record = chunk.mNext;
+			const internal::TraceRecordHeader head{ internal::trace_ticks(), signal, static_cast<std::uint32_t>(payload) };
+			std::memcpy(record, &head, sizeof(head));
+			record += sizeof(head);
+			((std::memcpy(record, &args, sizeof(Args)), record += sizeof(Args)), ...);
+
+			chunk.mNext += bytes;
+			internal::trace_pad(chunk.mNext, chunk.mEnd);
+		}
+
+		// Number of records dropped, the trace being full
+		size_type dropped() const noexcept
+		{
+			return m_dropped.load();
+		}
+	};
+
+	// Record of a trace, as read back
+	struct TraceRecord final
+	{
+		std::uint64_t mTimeNs;			// since the start of the trace
+		std::uint32_t mSignal;
+		std::uint32_t mSize;
+		const unsigned char* mPayload;
+	};
+
+	class EmissionTraceReader final
+	{
+	public:
+		using size_type = std::size_t;
+
+	private:
+		const unsigned char* mp_mapping;
+		size_type m_size;
+		double m_ns_per_tick;
+		std::vector<const unsigned char*> m_records;	// in time order
+
+		// Header at the start of the file
+		const internal::TraceHeader& header() const noexcept
+		{
+			return *reinterpret_cast<const internal::TraceHeader*>(mp_mapping);
+		}
+
+		// Timestamp of a record
+		static std::uint64_t ticks(const unsigned char* record) noexcept
+		{
+			internal::TraceRecordHeader head;
+			std::memcpy(&head, record, sizeof(head));
+			return head.mTicks;
+		}
+
+		// Index the records, in time order (the chunks of the threads interleave)
+		void index()
+		{
+			const unsigned char* record = mp_mapping + sizeof(internal::TraceHeader);
+			const unsigned char* const end = record + header().mBytes;
+
+			m_records.reserve(static_cast<size_type>(header().mRecords));
+			while (record + sizeof(internal::TraceRecordHeader) <= end)
+			{
+				internal::TraceRecordHeader head;
+				std::memcpy(&head, record, sizeof(head));
+				if (head.mSignal != internal::trace_padding)
+				{
+					m_records.push_back(record);
+				}
+				record += internal::trace_record_size(head.mSize);
+			}
+			std::stable_sort(m_records.begin(), m_records.end()
+				, [](const unsigned char* lhs, const unsigned char* rhs) { return ticks(lhs) < ticks(rhs); });
+		}
+
+	public:
+		// Map a trace file written by EmissionTrace.
+		// Throws std::system_error if the file cannot be read / is not a trace
+		explicit EmissionTraceReader(const std::string& path)
+			: mp_mapping{ nullptr }
+			, m_size{ 0u }
+			, m_ns_per_tick{ 1.0 }
+		{
+			const int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0)
+			{
+				throw std::system_error(errno, std::generic_category(), "open");
+			}
+			struct stat status {};
+			void* mapping = MAP_FAILED;
+			if (::fstat(fd, &status) == 0 && static_cast<size_type>(status.st_size) >= sizeof(internal::TraceHeader))
+			{
+				m_size = static_cast<size_type>(status.st_size);
+				mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			}
+			const int error = mapping == MAP_FAILED ? (errno ? errno : EINVAL) : 0;
+			::close(fd);
+			if (mapping == MAP_FAILED)
+			{
+				throw std::system_error(error, std::generic_category(), "mmap");
+			}
+
+			mp_mapping = static_cast<const unsigned char*>(mapping);
+			const internal::TraceHeader& head = header();
+			if (head.mMagic != internal::trace_magic || sizeof(internal::TraceHeader) + head.mBytes > m_size)
+			{
+				::munmap(const_cast<unsigned char*>(mp_mapping), m_size);
+				throw std::system_error(EINVAL, std::generic_category(), "not an emission trace");
+			}
+			if (head.mEndTicks > head.mStartTicks)
+			{
+				m_ns_per_tick = static_cast<double>(head.mEndNs - head.mStartNs)
+					/ static_cast<double>(head.mEndTicks - head.mStartTicks);
+			}
+
+			try
+			{
+				index();
+			}
+			catch (...)
+			{
+				::munmap(const_cast<unsigned char*>(mp_mapping), m_size);
+				throw;
+			}
+		}
+
+		// Deleted copy-constructor
+		EmissionTraceReader(const EmissionTraceReader&) = delete;
+
+		// Deleted copy-assignment operator
+		EmissionTraceReader& operator=(const EmissionTraceReader&) = delete;
+
+		// Destroy EmissionTraceReader
+		~EmissionTraceReader() noexcept
+		{
+			::munmap(const_cast<unsigned char*>(mp_mapping), m_size);
+		}
+
+		// Call the function with every record (TraceRecord), in time order
+		template<typename Function>
+		void for_each(Function&& function) const
+		{
+			const std::uint64_t start = header().mStartTicks;
+			for (const unsigned char* const record : m_records)
+			{
+				internal::TraceRecordHeader head;
+				std::memcpy(&head, record, sizeof(head));
+				const std::uint64_t ticks = head.mTicks > start ? head.mTicks - start : 0u;
+				function(TraceRecord{ static_cast<std::uint64_t>(static_cast<double>(ticks) * m_ns_per_tick)
+					, head.mSignal, head.mSize, record + sizeof(head) });
+			}
+		}
+
+		// Number of records in the trace
+		size_type records() const noexcept
+		{
+			return m_records.size();
+		}
+
+		// Number of records dropped while recording
+		size_type dropped() const noexcept
+		{
+			return static_cast<size_type>(header().mDropped);
+		}
+
+		// Duration of the recording, in nanoseconds
+		std::uint64_t duration_ns() const noexcept
+		{
+			return header().mEndNs - header().mStartNs;
+		}
+	};
+#endif // JEJO_HAS_MMAP
+}
+
+#endif // JEJO_EMISSION_TRACE_T_HPP
+
+/*****************************************************************************/
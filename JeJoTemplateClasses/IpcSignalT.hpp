@@ -0,0 +1,465 @@
+/******************************************************************************
+ * IpcSignal - Signal between the processes of one host, over a ring buffer
+ * in POSIX shared memory (shm_open() / mmap()); no socket, no serialization,
+ * no syscall per event and no external service.
+ *
+ * Every IpcSignal opened with the same name shares the ring. emit() publishes
+ * the arguments (trivially copyable, default constructible types) into the
+ * ring: a sequence number claimed with one fetch_add, and a per-slot sequence
+ * (seqlock) marking the slot as being written / published / dropped.
+ * Each IpcSignal object reads the ring with its own cursor: poll() delivers
+ * the events published since the last call to the slots connected to this
+ * object, with the familiar connect() API, in publication order.
+ *
+ * A subscriber lagging more than the ring capacity loses the overwritten
+ * events (counted by lost()). A publisher waits for the previous lap of its
+ * slot to be written, i.e. only when `capacity` publications are in flight,
+ * and at most for the timeout: a publisher stalled (or killed) in the middle
+ * of a write then costs the event of the waiting one, which marks its slot
+ * dropped (subscribers skip it) and returns false (counted by dropped()).
+ * The stalled publisher loses its event as well once it resumes, whether it
+ * stalled before claiming its slot or while writing it: a slot sequence never
+ * goes back to an older lap. Subscribers behind a killed publisher move on
+ * when the next lap reaches its slot.
+ * Opening waits for the creator to initialize the ring at most the timeout.
+ *
+ * emit() may be called from any thread / process; poll() from one thread per
+ * IpcSignal object. The shared memory object lives until remove(name).
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_IPC_SIGNAL_T_HPP
+#define JEJO_IPC_SIGNAL_T_HPP
+
+ // C++ headers
+#include <atomic>		// std::atomic<>, std::atomic_thread_fence()
+#include <cerrno>		// errno
+#include <chrono>		// std::chrono::steady_clock, std::chrono::milliseconds
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint32_t, std::uint64_t
+#include <cstring>		// std::memcpy()
+#include <limits>		// std::numeric_limits<>
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string
+#include <system_error>	// std::system_error
+#include <thread>		// std::this_thread::yield()
+#include <tuple>		// std::tuple<>, std::get<>()
+#include <type_traits>	// std::is_trivially_copyable_v<>
+#include <utility>		// std::forward<>(), std::index_sequence<>
+
+// own JeJo-lib headers
+#include "SignalsT.hpp"
+#include "MmapArenaT.hpp"	// JEJO_HAS_MMAP
+
+#if JEJO_HAS_MMAP
+#include <fcntl.h>		// O_CREAT, O_EXCL, O_RDWR
+#include <sys/mman.h>	// shm_open(), shm_unlink(), mmap(), munmap()
+#include <sys/stat.h>	// fstat()
+#include <unistd.h>		// ftruncate(), close()
+
+namespace JeJo
+{
+	template<typename Signature> class IpcSignal;
+
+	template<typename... Args> class IpcSignal<void(Args...)> final
+	{
+		static_assert((std::is_trivially_copyable_v<Args> && ...), "IpcSignal arguments must be trivially copyable");
+		static_assert((std::is_default_constructible_v<Args> && ...), "IpcSignal arguments must be default constructible");
+		static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "IpcSignal needs lock-free 64 bit atomics");
+
+	public:
+		using size_type = std::size_t;
+
+	private:
+		using SequenceType = std::atomic<std::uint64_t>;
+
+		// Bytes of the arguments in a slot
+		static constexpr size_type payload_size = (size_type{ 0u } + ... + sizeof(Args));
+
+		// Marks an initialized ring (of this slot sequence encoding)
+		static constexpr std::uint32_t ring_magic = 0x4A654A70u;
+
+		// Header of the shared memory object
+		struct alignas(64) RingHeader
+		{
+			std::atomic<std::uint32_t> mReady;	// ring_magic once initialized
+			std::uint32_t mCapacity;			// slots, power of two
+			std::uint32_t mPayloadSize;
+			alignas(64) SequenceType mHead;		// next sequence number to publish
+		};
+
+		// Slot of the ring: see writing_state(), published_state(), dropped_state()
+		struct alignas(64) RingSlot
+		{
+			SequenceType mSequence;
+			unsigned char mPayload[payload_size ? payload_size : 1u];
+		};
+
+		Signal<void(Args...)> m_local;
+		RingHeader* mp_header;
+		RingSlot* mp_slots;
+		size_type m_mapping_size;
+		std::uint64_t m_mask;
+		std::uint64_t m_cursor;	// next sequence number to deliver
+		size_type m_lost;
+		std::atomic<size_type> m_dropped;
+		std::chrono::milliseconds m_timeout;
+		int m_fd;
+
+	private:
+		// Throw the error of the last system call
+		[[noreturn]] static void fail(const char* what)
+		{
+			throw std::system_error(errno, std::generic_category(), what);
+		}
+
+		// Size of the shared memory object for the capacity
+		static size_type mapping_size(size_type capacity) noexcept
+		{
+			return sizeof(RingHeader) + capacity * sizeof(RingSlot);
+		}
+
+		// Slot of a sequence number
+		RingSlot& slot(std::uint64_t sequence) const noexcept
+		{
+			return mp_slots[sequence & m_mask];
+		}
+
+		// Slot sequence while the event of the sequence number is written
+		static constexpr std::uint64_t writing_state(std::uint64_t sequence) noexcept
+		{
+			return 4u * sequence + 1u;
+		}
+
+		// Slot sequence once the event of the sequence number is published
+		static constexpr std::uint64_t published_state(std::uint64_t sequence) noexcept
+		{
+			return 4u * sequence + 2u;
+		}
+
+		// Slot sequence if the event of the sequence number was dropped
+		static constexpr std::uint64_t dropped_state(std::uint64_t sequence) noexcept
+		{
+			return 4u * sequence + 3u;
+		}
+
+		// Wait (yielding) until the condition holds; false after the timeout
+		template<typename Condition>
+		bool wait_for(Condition&& condition) const noexcept
+		{
+			const auto deadline = std::chrono::steady_clock::now() + m_timeout;
+			while (!condition())
+			{
+				if (std::chrono::steady_clock::now() >= deadline)
+				{
+					return false;
+				}
+				std::this_thread::yield();
+			}
+			return true;
+		}
+
+		// Map the object; the first process creates and initializes it
+		void open(const std::string& name, size_type capacity)
+		{
+			bool creator = true;
+			m_fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+			if (m_fd < 0 && errno == EEXIST)
+			{
+				creator = false;
+				m_fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+			}
+			if (m_fd < 0)
+			{
+				fail("shm_open");
+			}
+
+			size_type size = mapping_size(capacity);
+			if (creator)
+			{
+				if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+				{
+					fail("ftruncate");
+				}
+			}
+			else
+			{
+				// the creator may not have sized it yet
+				struct stat status {};
+				const bool sized = wait_for([&] {
+					return ::fstat(m_fd, &status) != 0 || static_cast<size_type>(status.st_size) >= sizeof(RingHeader);
+				});
+				if (!sized)
+				{
+					throw std::runtime_error("IpcSignal: " + name + " not sized by its creator (remove() it if the creator died)");
+				}
+				size = static_cast<size_type>(status.st_size);
+			}
+
+			void* const mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+			if (mapping == MAP_FAILED)
+			{
+				fail("mmap");
+			}
+			mp_header = static_cast<RingHeader*>(mapping);
+			mp_slots = reinterpret_cast<RingSlot*>(static_cast<unsigned char*>(mapping) + sizeof(RingHeader));
+			m_mapping_size = size;
+
+			if (creator)
+			{
+				// ftruncate() zero filled it: all the sequences are 0
+				mp_header->mCapacity = static_cast<std::uint32_t>(capacity);
+				mp_header->mPayloadSize = static_cast<std::uint32_t>(payload_size);
+				mp_header->mReady.store(ring_magic, std::memory_order_release);
+			}
+			else
+			{
+				if (!wait_for([this] { return mp_header->mReady.load(std::memory_order_acquire) == ring_magic; }))
+				{
+					throw std::runtime_error("IpcSignal: " + name + " not initialized by its creator (remove() it if the creator died)");
+				}
+				if (mp_header->mPayloadSize != payload_size
+					|| mapping_size(mp_header->mCapacity) != m_mapping_size)
+				{
+					throw std::runtime_error("IpcSignal: " + name + " has another signature");
+				}
+			}
+
+			m_mask = mp_header->mCapacity - 1u;
+			m_cursor = mp_header->mHead.load(std::memory_order_acquire);
+		}
+
+		// Unmap the object
+		void close() noexcept
+		{
+			if (mp_header)
+			{
+				::munmap(mp_header, m_mapping_size);
+			}
+			if (m_fd >= 0)
+			{
+				::close(m_fd);
+			}
+			mp_header = nullptr;
+			mp_slots = nullptr;
+			m_fd = -1;
+		}
+
+		// Copy the arguments out of a payload and emit them to the local slots
+		template<size_type... Index>
+		void deliver(const unsigned char* payload, std::index_sequence<Index...>)
+		{
+			std::tuple<Args...> args{};
+			size_type offset = 0u;
+			((std::memcpy(&std::get<Index>(args), payload + offset, sizeof(Args)), offset += sizeof(Args)), ...);
+			m_local(std::get<Index>(args)...);
+		}
+
+	public:
+		// Open (or create) the shared memory object of the name, e.g. "/my-events".
+		// The capacity (rounded up to a power of two) is the one of the creator.
+		// The timeout bounds the waits for the other processes (see above).
+		// Throws std::system_error if the object cannot be opened / mapped, and
+		// std::runtime_error if it was created for other arguments or its
+		// creator did not initialize it within the timeout.
+		explicit IpcSignal(const std::string& name, size_type capacity = 1024u
+			, std::chrono::milliseconds timeout = std::chrono::milliseconds(1000))
+			: m_local{}
+			, mp_header{ nullptr }
+			, mp_slots{ nullptr }
+			, m_mapping_size{ 0u }
+			, m_mask{ 0u }
+			, m_cursor{ 0u }
+			, m_lost{ 0u }
+			, m_dropped{ 0u }
+			, m_timeout{ timeout }
+			, m_fd{ -1 }
+		{
+			size_type slots = 1u;
+			while (slots < capacity && slots <= std::numeric_limits<std::uint32_t>::max() / 2u)
+			{
+				slots *= 2u;
+			}
+			try
+			{
+				open(name, slots);
+			}
+			catch (...)
+			{
+				close();
+				throw;
+			}
+		}
+
+		// Deleted copy-constructor
+		IpcSignal(const IpcSignal&) = delete;
+
+		// Deleted copy-assignment operator
+		IpcSignal& operator=(const IpcSignal&) = delete;
+
+		// Destroy IpcSignal, unmap the object (it stays for the other processes)
+		~IpcSignal() noexcept
+		{
+			close();
+		}
+
+		// Remove the shared memory object of the name; the processes having
+		// it mapped keep using it
+		static bool remove(const std::string& name) noexcept
+		{
+			return ::shm_unlink(name.c_str()) == 0;
+		}
+
+		// Publish an event to all the IpcSignals of the name. Returns false if
+		// the event was dropped: the previous lap of its slot was not written
+		// within the timeout, or a later publisher dropped it meanwhile.
+		bool emit(const Args&... args) noexcept
+		{
+			const std::uint64_t sequence = mp_header->mHead.fetch_add(1u, std::memory_order_acq_rel);
+			RingSlot& target = slot(sequence);
+
+			// the previous lap of the slot must be complete (published or dropped)
+			const std::uint64_t capacity = m_mask + 1u;
+			const std::uint64_t previous = sequence >= capacity ? published_state(sequence - capacity) : 0u;
+			std::uint64_t current = 0u;
+			const bool complete = wait_for([&] {
+				current = target.mSequence.load(std::memory_order_acquire);
+				return current >= previous;
+			});
+
+			// overtaken: a later lap gave up waiting for this publisher (no going back)
+			if (current >= writing_state(sequence))
+			{
+				m_dropped.fetch_add(1u, std::memory_order_relaxed);
+				return false;
+			}
+
+			// claim the slot; a stalled previous lap gets the own event dropped instead
+			if (!complete || !target.mSequence.compare_exchange_strong(current, writing_state(sequence), std::memory_order_relaxed))
+			{
+				while (current < writing_state(sequence)
+					&& !target.mSequence.compare_exchange_weak(current, dropped_state(sequence), std::memory_order_release))
+				{
+					// current reloaded by the failed exchange
+				}
+				m_dropped.fetch_add(1u, std::memory_order_relaxed);
+				return false;
+			}
+			std::atomic_thread_fence(std::memory_order_release);
+			size_type offset = 0u;
+			((std::memcpy(target.mPayload + offset, &args, sizeof(Args)), offset += sizeof(Args)), ...);
+
+			// a later publisher may have given up waiting for this one
+			std::uint64_t claimed = writing_state(sequence);
+			if (!target.mSequence.compare_exchange_strong(claimed, published_state(sequence), std::memory_order_release))
+			{
+				m_dropped.fetch_add(1u, std::memory_order_relaxed);
+				return false;
+			}
+			return true;
+		}
+
+		// Publish an event to all the IpcSignals of the name; see emit()
+		bool operator()(const Args&... args) noexcept
+		{
+			return emit(args...);
+		}
+
+		// Deliver the published events, at most max_events, to the connected slots.
+		// Returns the number of delivered events.
+		// May throw exception if some slot does
+		size_type poll(size_type max_events = std::numeric_limits<size_type>::max())
+		{
+			unsigned char payload[payload_size ? payload_size : 1u];
+			size_type delivered = 0u;
+
+			while (delivered < max_events)
+			{
+				RingSlot& source = slot(m_cursor);
+				const std::uint64_t before = source.mSequence.load(std::memory_order_acquire);
+				if (before < published_state(m_cursor))
+				{
+					break; // not published yet
+				}
+				if (before == dropped_state(m_cursor))
+				{
+					++m_cursor; // no event
+					continue;
+				}
+
+				std::memcpy(payload, source.mPayload, payload_size);
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (before != published_state(m_cursor) || source.mSequence.load(std::memory_order_relaxed) != before)
+				{
+					// overwritten by a later lap: skip to the oldest event still in the ring
+					const std::uint64_t head = mp_header->mHead.load(std::memory_order_acquire);
+					const std::uint64_t oldest = head > m_mask + 1u ? head - (m_mask + 1u) : 0u;
+					const std::uint64_t next = oldest > m_cursor ? oldest : m_cursor + 1u;
+					m_lost += static_cast<size_type>(next - m_cursor);
+					m_cursor = next;
+					continue;
+				}
+
+				++m_cursor;
+				++delivered;
+				deliver(payload, std::index_sequence_for<Args...>{});
+			}
+
+			return delivered;
+		}
+
+		// Number of events lost by this subscriber (overwritten before poll())
+		size_type lost() const noexcept
+		{
+			return m_lost;
+		}
+
+		// Number of events emitted through this object and dropped
+		size_type dropped() const noexcept
+		{
+			return m_dropped.load();
+		}
+
+		// Number of slots of the ring
+		size_type capacity() const noexcept
+		{
+			return static_cast<size_type>(m_mask + 1u);
+		}
+
+		// Connect a slot to the events of this object; see Signal::connect()
+		// May throw exception if memory allocation fails
+		template<typename... Targets>
+		bool connect(Targets&&... targets)
+		{
+			return m_local.connect(std::forward<Targets>(targets)...);
+		}
+
+		// Disconnect a slot; see Signal::disconnect()
+		template<typename... Targets>
+		bool disconnect(Targets&&... targets) noexcept
+		{
+			return m_local.disconnect(std::forward<Targets>(targets)...);
+		}
+
+		// Check whether a slot is connected; see Signal::connected()
+		template<typename... Targets>
+		bool connected(Targets&&... targets) const noexcept
+		{
+			return m_local.connected(std::forward<Targets>(targets)...);
+		}
+
+		// Get number of connected slots
+		size_type size() const noexcept
+		{
+			return m_local.size();
+		}
+	};
+}
+#endif // JEJO_HAS_MMAP
+
+#endif // JEJO_IPC_SIGNAL_T_HPP
+
+/*****************************************************************************/
@@ -2,6 +2,9 @@
  * SlimLock - Synchronization primitive that protects shared data from being
  * simultaneously modified by multiple threads. Optimized for speed
  * and occupies very little memory. Meets Lockable requirements.
+ * A thread waiting for long makes the new arrivals wait behind it, so a
+ * thread re-locking in a loop cannot starve the others (without the hand-off
+ * cost of a strictly fair lock when there are more threads than cores).
  * 
  * AutoLock - ClassType AutoLock is a SlimLock ownership wrapper that provides a
  * convenient RAII-style mechanism for automatic locking / unlocking.
@@ -9,6 +12,14 @@
  * ReadGuard - ClassType ReadGuard is a stage counter ownership wrapper. Provides
  * a convenient RAII-style mechanism for automatic increm / decrem.
  *
+ * rcu_ptr - Pointer to a read-mostly value (configuration tables, routing
+ * maps): read() takes no lock, update() copies the value, changes the copy
+ * and publishes it. The replaced values are deleted later, once no reader
+ * may see them, with the two stage counters of the Signal: a reader counts
+ * itself in the current stage, the writers delete the values retired in the
+ * other stage once its count is 0 and switch the stage. The writers take
+ * turns on a SlimLock. At most 65535 readers at the same time (CounterType).
+ *
  * @Authur :  JeJo
  * @Date   :  June - 2021
  * @license: free to use and distribute(no further support as well)
@@ -20,22 +31,55 @@
 #define JEJO_LOCK_CLASSES_T_HPP
 
  // C++ headers
-#include <atomic>       // std::atomic_flag, std::memory_order_xxxx
+#include <atomic>       // std::atomic<>, std::atomic_flag, std::memory_order_xxxx
 #include <thread>       // std::this_thread::yield
 #include <utility>      // std::exchange
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint8_t, std::uint32_t
+#include <functional>   // std::invoke()
+#include <memory>       // std::unique_ptr<>, std::make_unique<>()
 
 
 // own JeJo-lib headers
 //#include "SlotT.hpp"
 
+// Hook for the real-time test harness, counts an operation of the current thread
+#ifdef JEJO_SIGNAL_RT_HOOKS
+#define JEJO_RT_HOOK(counter) static_cast<void>(++::JeJo::internal::rt_hook_counters.counter)
+#else
+#define JEJO_RT_HOOK(counter) static_cast<void>(0)
+#endif
+
 namespace JeJo::internal
 {
+	using CounterType = std::atomic<unsigned short>;
+
+#ifdef JEJO_SIGNAL_RT_HOOKS
+	// Per thread counts of the operations a real-time emission must not do, for the
+	// test harness (realtimeEmitTest()): locks counted by SlimLock, allocations by
+	// the harness' replacement of the global operator new / delete.
+	struct RtHookCounters final
+	{
+		std::size_t mAllocations{ 0u };
+		std::size_t mDeallocations{ 0u };
+		std::size_t mLocks{ 0u };	// lock() and try_lock() calls
+
+		bool operator==(const RtHookCounters& other) const noexcept = default;
+	};
+
+	inline thread_local RtHookCounters rt_hook_counters{};
+#endif
+
 	class SlimLock final
 	{
 	private:
 		using lock_type = std::atomic_flag;
 
+		// failed attempts after which a waiter is starving
+		static constexpr unsigned starving_after = 16u;
+
 		lock_type m_lock = ATOMIC_FLAG_INIT;
+		std::atomic<std::uint32_t> m_starving{ 0u };	// starving waiters (no wrap to 0 with many threads)
 
 	public:
 		// Construct SlimLock
@@ -54,10 +98,26 @@ namespace JeJo::internal
 		// SlimLock, blocks execution until the lock is acquired.
 		void lock() noexcept
 		{
+			JEJO_RT_HOOK(mLocks);
+			// let the starving waiters go first
+			while (m_starving.load(std::memory_order_relaxed))
+			{
+				std::this_thread::yield();
+			}
+
+			unsigned attempts = 0u;
 			while (m_lock.test_and_set(std::memory_order_acquire))
 			{
+				if (++attempts == starving_after)
+				{
+					m_starving.fetch_add(1u, std::memory_order_relaxed);
+				}
 				std::this_thread::yield();
 			}
+			if (attempts >= starving_after)
+			{
+				m_starving.fetch_sub(1u, std::memory_order_relaxed);
+			}
 		}
 
 		// Unlock SlimLock
@@ -70,6 +130,7 @@ namespace JeJo::internal
 		// lock acquisition returns true, otherwise returns false.
 		bool try_lock() noexcept
 		{
+			JEJO_RT_HOOK(mLocks);
 			return m_lock.test_and_set(std::memory_order_acquire) ? false : true;
 		}
 
@@ -149,6 +210,202 @@ namespace JeJo::internal
 	};
 }
 
+namespace JeJo
+{
+	// TEMPLATE CLASS rcu_ptr
+	template<typename Type>
+	class rcu_ptr final
+	{
+	private:
+		// A value, linked in a list of retired ones once replaced
+		struct Node final
+		{
+			Type mValue;
+			Node* mRetiredPtr{ nullptr };
+
+			template<typename... Values>
+			explicit Node(Values&&... values)
+				: mValue(std::forward<Values>(values)...)
+			{}
+		};
+
+		enum class Stage : std::uint8_t { Stage_1, Stage_2 };
+
+		std::atomic<Node*>				mp_current;
+		mutable internal::CounterType	m_readers_s1;
+		mutable internal::CounterType	m_readers_s2;
+		std::atomic<Stage>				m_stage;
+		Node*							mp_retired_s1;	// replaced values of the stages
+		Node*							mp_retired_s2;
+		internal::SlimLock				m_write_lock;
+
+		// Delete a list of retired values
+		static void destroy(Node* node) noexcept
+		{
+			while (node)
+			{
+				delete std::exchange(node, node->mRetiredPtr);
+			}
+		}
+
+		// Delete the values of the other stage if no reader counts itself there,
+		// then switch to it. Returns false if readers hold it.
+		// Must be called under m_write_lock
+		bool synchronize_stage() noexcept
+		{
+			if (m_stage.load() == Stage::Stage_1)
+			{
+				if (m_readers_s2.load())
+				{
+					return false;
+				}
+				destroy(std::exchange(mp_retired_s2, nullptr));
+				m_stage.store(Stage::Stage_2);
+			}
+			else
+			{
+				if (m_readers_s1.load())
+				{
+					return false;
+				}
+				destroy(std::exchange(mp_retired_s1, nullptr));
+				m_stage.store(Stage::Stage_1);
+			}
+			return true;
+		}
+
+		// Publish the value and retire the replaced one into the current stage
+		// Must be called under m_write_lock
+		void publish(std::unique_ptr<Node> node) noexcept
+		{
+			Node* const replaced = mp_current.exchange(node.release());
+			Node*& retired = m_stage.load() == Stage::Stage_1 ? mp_retired_s1 : mp_retired_s2;
+			replaced->mRetiredPtr = retired;
+			retired = replaced;
+			synchronize_stage();
+		}
+
+	public:
+		// Reader access to the value: the value stays alive for the guard's life
+		class read_guard final
+		{
+		private:
+			internal::ReadGuard m_guard;
+			const Type* mp_value;
+
+		public:
+			// Construct read_guard
+			read_guard(internal::CounterType& counter, const std::atomic<Node*>& current) noexcept
+				: m_guard{ counter }
+				, mp_value{ &current.load()->mValue }
+			{}
+
+			// Move-construct read_guard
+			read_guard(read_guard&&) noexcept = default;
+
+			// Deleted move-assignment operator
+			read_guard& operator=(read_guard&&) = delete;
+
+			// Get the value
+			const Type& operator*() const noexcept
+			{
+				return *mp_value;
+			}
+
+			// Access the value
+			const Type* operator->() const noexcept
+			{
+				return mp_value;
+			}
+
+			// Get pointer to the value
+			const Type* get() const noexcept
+			{
+				return mp_value;
+			}
+		};
+
+		// Construct rcu_ptr holding a value constructed from the arguments
+		// May throw exception if memory allocation / the constructor of the value does
+		template<typename... Values>
+		explicit rcu_ptr(Values&&... values)
+			: mp_current{ new Node(std::forward<Values>(values)...) }
+			, m_readers_s1{ 0u }
+			, m_readers_s2{ 0u }
+			, m_stage{ Stage::Stage_1 }
+			, mp_retired_s1{ nullptr }
+			, mp_retired_s2{ nullptr }
+			, m_write_lock{}
+		{}
+
+		// Deleted copy-constructor
+		rcu_ptr(const rcu_ptr&) = delete;
+
+		// Deleted copy-assignment operator
+		rcu_ptr& operator=(const rcu_ptr&) = delete;
+
+		// Destroy rcu_ptr; no read_guard may be alive
+		~rcu_ptr() noexcept
+		{
+			destroy(mp_retired_s1);
+			destroy(mp_retired_s2);
+			delete mp_current.load();
+		}
+
+		// Read the value: wait-free, no lock
+		read_guard read() const noexcept
+		{
+			return read_guard(m_stage.load() == Stage::Stage_1 ? m_readers_s1 : m_readers_s2, mp_current);
+		}
+
+		// Copy the value, call the function with the copy and publish it.
+		// Nothing is published if the function throws. The replaced value is
+		// deleted by a later update() / reclaim() once no reader sees it.
+		// May throw exception if memory allocation / the copy / the function does
+		template<typename Function>
+		void update(Function&& function)
+		{
+			const internal::AutoLock guard{ m_write_lock };
+			auto node = std::make_unique<Node>(mp_current.load()->mValue);
+			std::invoke(std::forward<Function>(function), node->mValue);
+			publish(std::move(node));
+		}
+
+		// Publish a value constructed from the arguments, replacing the value
+		// May throw exception if memory allocation / the constructor of the value does
+		template<typename... Values>
+		void store(Values&&... values)
+		{
+			auto node = std::make_unique<Node>(std::forward<Values>(values)...);
+			const internal::AutoLock guard{ m_write_lock };
+			publish(std::move(node));
+		}
+
+		// Delete the replaced values no reader may see; does not wait for the readers.
+		// Returns true if none is left.
+		bool reclaim() noexcept
+		{
+			const internal::AutoLock guard{ m_write_lock };
+			// two switches: both stages emptied
+			if (synchronize_stage())
+			{
+				synchronize_stage();
+			}
+			return !mp_retired_s1 && !mp_retired_s2;
+		}
+
+		// Wait until all the replaced values are deleted.
+		// Must not be called while the calling thread holds a read_guard
+		void synchronize() noexcept
+		{
+			while (!reclaim())
+			{
+				std::this_thread::yield();
+			}
+		}
+	};
+}
+
 #endif // JEJO_LOCK_CLASSES_T_HPP
 
 /*****************************************************************************/
\ No newline at end of file
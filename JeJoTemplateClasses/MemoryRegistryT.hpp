@@ -0,0 +1,182 @@
+/******************************************************************************
+ * SignalMemoryStats - Memory held by one Signal<>: the statistics of its
+ * Storage<> plus the connected slots and the Connection nodes which are
+ * logically removed but wait for the deferred reclamation (both stages).
+ *
+ * MemoryRegistry - Process-wide registry of all the living Signals. Sums up
+ * their memory statistics and dumps them on demand. Signals attach
+ * themselves on construction and detach on destruction (one SlimLock).
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_MEMORY_REGISTRY_T_HPP
+#define JEJO_MEMORY_REGISTRY_T_HPP
+
+ // C++ headers
+#include <cstddef>		// std::size_t
+#include <ostream>		// std::ostream
+
+// own JeJo-lib headers
+#include "LockClassesT.hpp"
+#include "PoolAllocatorT.hpp"
+
+namespace JeJo
+{
+	// Memory statistics of a Signal
+	struct SignalMemoryStats final
+	{
+		PoolStats mStorage{};					// Storage<> of the Signal
+		std::size_t mConnections{ 0u };			// connected slots
+		std::size_t mPendingReclaim_s1{ 0u };	// removed nodes waiting for stage 1 readers
+		std::size_t mPendingReclaim_s2{ 0u };	// removed nodes waiting for stage 2 readers
+
+		SignalMemoryStats& operator+=(const SignalMemoryStats& other) noexcept
+		{
+			mStorage += other.mStorage;
+			mConnections += other.mConnections;
+			mPendingReclaim_s1 += other.mPendingReclaim_s1;
+			mPendingReclaim_s2 += other.mPendingReclaim_s2;
+			return *this;
+		}
+	};
+
+	// Print memory statistics in one line
+	inline std::ostream& operator<<(std::ostream& out, const SignalMemoryStats& stats)
+	{
+		return out << "blocks: " << stats.mStorage.mBlocks
+			<< ", bytes reserved: " << stats.mStorage.mBytesReserved
+			<< ", nodes in use: " << stats.mStorage.mNodesInUse
+			<< ", nodes free: " << stats.mStorage.mNodesFree
+			<< ", high-water (highest pool): " << stats.mStorage.mHighWater
+			<< ", connections: " << stats.mConnections
+			<< ", pending reclaim: " << stats.mPendingReclaim_s1 << " + " << stats.mPendingReclaim_s2;
+	}
+
+	class MemoryRegistry;
+
+	namespace internal
+	{
+		// Intrusive link of a Signal in the MemoryRegistry
+		class RegistryHook final
+		{
+		private:
+			friend class JeJo::MemoryRegistry;
+			using StatsFunction = SignalMemoryStats(*)(const void*);
+
+			RegistryHook* mPrevHook{ nullptr };
+			RegistryHook* mNextHook{ nullptr };
+			const void* mOwner{ nullptr };
+			StatsFunction mStatsFn{ nullptr };
+
+		public:
+			// Construct RegistryHook for the owner and its statistics function
+			RegistryHook(const void* owner, StatsFunction statsFn) noexcept
+				: mOwner{ owner }
+				, mStatsFn{ statsFn }
+			{}
+
+			// Deleted copy-constructor
+			RegistryHook(const RegistryHook&) = delete;
+
+			// Deleted copy-assignment operator
+			RegistryHook& operator=(const RegistryHook&) = delete;
+		};
+	}
+
+	class MemoryRegistry final
+	{
+	private:
+		internal::RegistryHook* mFirstHook{ nullptr };
+		std::size_t mCount{ 0u };
+		mutable internal::SlimLock mLock{};
+
+		// Construct MemoryRegistry
+		MemoryRegistry() noexcept = default;
+
+	public:
+		// Deleted copy-constructor
+		MemoryRegistry(const MemoryRegistry&) = delete;
+
+		// Deleted copy-assignment operator
+		MemoryRegistry& operator=(const MemoryRegistry&) = delete;
+
+		// The process-wide registry (never destroyed: Signals with static storage may outlive it)
+		static MemoryRegistry& instance()
+		{
+			static MemoryRegistry* const registry = new MemoryRegistry{};
+			return *registry;
+		}
+
+		// Attach a Signal
+		void attach(internal::RegistryHook& hook) noexcept
+		{
+			const internal::AutoLock guard{ mLock };
+			hook.mPrevHook = nullptr;
+			hook.mNextHook = mFirstHook;
+			if (mFirstHook)
+			{
+				mFirstHook->mPrevHook = &hook;
+			}
+			mFirstHook = &hook;
+			++mCount;
+		}
+
+		// Detach a Signal
+		void detach(internal::RegistryHook& hook) noexcept
+		{
+			const internal::AutoLock guard{ mLock };
+			(hook.mPrevHook ? hook.mPrevHook->mNextHook : mFirstHook) = hook.mNextHook;
+			if (hook.mNextHook)
+			{
+				hook.mNextHook->mPrevHook = hook.mPrevHook;
+			}
+			hook.mPrevHook = hook.mNextHook = nullptr;
+			--mCount;
+		}
+
+		// Number of living Signals
+		std::size_t size() const noexcept
+		{
+			const internal::AutoLock guard{ mLock };
+			return mCount;
+		}
+
+		// Sum of the memory statistics of all the living Signals.
+		// Takes the registry lock, then the lock of each Signal: no Signal may
+		// attach / detach while holding its own lock
+		SignalMemoryStats aggregate() const noexcept
+		{
+			const internal::AutoLock guard{ mLock };
+			SignalMemoryStats total{};
+			for (const internal::RegistryHook* hook = mFirstHook; hook; hook = hook->mNextHook)
+			{
+				total += hook->mStatsFn(hook->mOwner);
+			}
+			return total;
+		}
+
+		// Dump the aggregate (and optionally every Signal) to the stream
+		void dump(std::ostream& out, bool perSignal = false) const
+		{
+			const internal::AutoLock guard{ mLock };
+			SignalMemoryStats total{};
+			for (const internal::RegistryHook* hook = mFirstHook; hook; hook = hook->mNextHook)
+			{
+				const SignalMemoryStats stats = hook->mStatsFn(hook->mOwner);
+				if (perSignal)
+				{
+					out << "Signal " << hook->mOwner << ": " << stats << '\n';
+				}
+				total += stats;
+			}
+			out << mCount << " Signals: " << total << '\n';
+		}
+	};
+}
+
+#endif // JEJO_MEMORY_REGISTRY_T_HPP
+
+/*****************************************************************************/
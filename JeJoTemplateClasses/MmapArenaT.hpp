@@ -0,0 +1,203 @@
+/******************************************************************************
+ * MmapArena - Bump allocator over one large virtual memory range reserved
+ * with mmap(). Used by Storage<> (through FixedPool<>) for Signals with very
+ * large subscriber counts: all the Connection nodes come from one range,
+ * which may be backed by transparent huge pages (MADV_HUGEPAGE) and can be
+ * pre-faulted at construction, so that the first emission does not page fault.
+ *
+ * Falls back gracefully: if mmap() is not available or fails, or the range is
+ * exhausted, allocate() returns nullptr and the caller uses the heap instead.
+ * Huge pages are only a hint; without them the range uses normal pages.
+ *
+ * Not thread safe: the owner (Storage<>) is protected by the Signal's lock.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_MMAP_ARENA_T_HPP
+#define JEJO_MMAP_ARENA_T_HPP
+
+ // C++ headers
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uintptr_t
+#include <utility>		// std::exchange
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>	// mmap(), munmap(), madvise()
+#include <unistd.h>		// sysconf()
+#define JEJO_HAS_MMAP 1
+#else
+#define JEJO_HAS_MMAP 0
+#endif
+
+namespace JeJo
+{
+	// Configuration of a MmapArena
+	struct ArenaConfig final
+	{
+		std::size_t mReserveBytes{ 64u << 20u };	// virtual range to reserve
+		std::size_t mPrefaultBytes{ 0u };			// bytes to touch at construction
+		bool mHugePages{ true };					// request transparent huge pages
+	};
+
+	class MmapArena final
+	{
+	public:
+		using size_type = std::size_t;
+
+		// Alignment used for the range, the size of a (x86-64 / AArch64) huge page
+		static constexpr size_type huge_page_size = size_type{ 2u } << 20u;
+
+	private:
+		void* mMapping;
+		size_type mMappingSize;
+		unsigned char* mBase;
+		size_type mSize;
+		size_type mUsed;
+		bool mHugePages;
+
+	private:
+		// Size of a normal memory page
+		static size_type pageSize() noexcept
+		{
+#if JEJO_HAS_MMAP
+			const long size = ::sysconf(_SC_PAGESIZE);
+			return size > 0 ? static_cast<size_type>(size) : 4096u;
+#else
+			return 4096u;
+#endif
+		}
+
+		// Reserve the virtual range; leaves the arena unmapped on failure
+		void reserve(const ArenaConfig& config) noexcept
+		{
+#if JEJO_HAS_MMAP
+			if (!config.mReserveBytes)
+			{
+				return;
+			}
+
+			const size_type size = (config.mReserveBytes + huge_page_size - 1u) / huge_page_size * huge_page_size;
+			int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+			flags |= MAP_NORESERVE;
+#endif
+			// over-reserve by one huge page, to be able to align the base on it
+			void* const mapping = ::mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+			if (mapping == MAP_FAILED)
+			{
+				return;
+			}
+
+			mMapping = mapping;
+			mMappingSize = size + huge_page_size;
+			const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(mapping);
+			mBase = reinterpret_cast<unsigned char*>((address + huge_page_size - 1u) / huge_page_size * huge_page_size);
+			mSize = size;
+
+#ifdef MADV_HUGEPAGE
+			if (config.mHugePages)
+			{
+				mHugePages = ::madvise(mBase, mSize, MADV_HUGEPAGE) == 0;
+			}
+#endif
+			prefault(config.mPrefaultBytes < mSize ? config.mPrefaultBytes : mSize);
+#else
+			static_cast<void>(config);
+#endif
+		}
+
+		// Touch the first bytes of the range, one write per page
+		void prefault(size_type bytes) noexcept
+		{
+			const size_type step = pageSize();
+			for (size_type offset = 0u; offset < bytes; offset += step)
+			{
+				*static_cast<volatile unsigned char*>(mBase + offset) = 0u;
+			}
+		}
+
+		// Release the virtual range
+		void release() noexcept
+		{
+#if JEJO_HAS_MMAP
+			if (mMapping)
+			{
+				::munmap(mMapping, mMappingSize);
+			}
+#endif
+			mMapping = nullptr;
+			mMappingSize = 0u;
+			mBase = nullptr;
+			mSize = mUsed = 0u;
+			mHugePages = false;
+		}
+
+	public:
+		// Construct MmapArena. Does not throw: on failure the arena stays unmapped.
+		explicit MmapArena(const ArenaConfig& config = {}) noexcept
+			: mMapping{ nullptr }
+			, mMappingSize{ 0u }
+			, mBase{ nullptr }
+			, mSize{ 0u }
+			, mUsed{ 0u }
+			, mHugePages{ false }
+		{
+			reserve(config);
+		}
+
+		// Deleted copy-constructor
+		MmapArena(const MmapArena&) = delete;
+
+		// Deleted copy-assignment operator
+		MmapArena& operator=(const MmapArena&) = delete;
+
+		// Destroy MmapArena, all the memory handed out becomes invalid
+		~MmapArena() noexcept
+		{
+			release();
+		}
+
+		// Allocate bytes from the range. Returns nullptr if the range is unavailable or exhausted.
+		[[nodiscard]] void* allocate(size_type bytes, size_type align) noexcept
+		{
+			const size_type offset = (mUsed + align - 1u) / align * align;
+			if (!mBase || offset > mSize || bytes > mSize - offset)
+			{
+				return nullptr;
+			}
+			mUsed = offset + bytes;
+			return mBase + offset;
+		}
+
+		// Check whether the virtual range has been reserved
+		bool mapped() const noexcept
+		{
+			return mBase != nullptr;
+		}
+
+		// Check whether the kernel accepted the huge page hint
+		bool huge_pages() const noexcept
+		{
+			return mHugePages;
+		}
+
+		// Size of the reserved range
+		size_type reserved() const noexcept
+		{
+			return mSize;
+		}
+
+		// Bytes handed out so far
+		size_type used() const noexcept
+		{
+			return mUsed;
+		}
+	};
+}
+
+#endif // JEJO_MMAP_ARENA_T_HPP
+
+/*****************************************************************************/
@@ -0,0 +1,390 @@
+/******************************************************************************
+ * FixedPool - Memory manager for equally sized memory nodes. Keeps chained
+ * memory blocks of nodes and hands them out from an intrusive free list.
+ * This is the pool which used to live inside Storage<> only. Memory blocks
+ * can be carved from a MmapArena instead of the heap.
+ *
+ * PoolAllocator - Meets the standard Allocator requirements. Single object
+ * allocations (as the node based containers std::list, std::set, std::map
+ * do) are served by a FixedPool, shared by all the types of the same size
+ * and alignment. Array allocations go to the default allocator.
+ *
+ * PoolMode::Shared      - one pool per process, guarded by a SlimLock.
+ * PoolMode::ThreadLocal - one pool per thread, no locking at all. Memory has
+ *                         to be deallocated by the thread which allocated it,
+ *                         before the thread exits.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_POOL_ALLOCATOR_T_HPP
+#define JEJO_POOL_ALLOCATOR_T_HPP
+
+ // C++ headers
+#include <algorithm>	// std::max()
+#include <cstddef>		// std::size_t, std::ptrdiff_t, std::max_align_t
+#include <new>			// ::new(), std::align_val_t
+#include <memory>		// std::allocator<>
+#include <type_traits>	// std::true_type
+#include <utility>		// std::exchange
+
+// own JeJo-lib headers
+#include "LockClassesT.hpp"
+#include "MmapArenaT.hpp"
+
+// Macros for dynamic memory allocation
+#ifndef NEW_MEMORY
+#define NEW_MEMORY(arg) ::operator new(arg)
+#define DELETE_MEMORY(arg) ::operator delete(arg)
+#endif
+
+namespace JeJo
+{
+	// Memory statistics of a FixedPool
+	struct PoolStats final
+	{
+		std::size_t mBlocks{ 0u };			// memory blocks allocated
+		std::size_t mBytesReserved{ 0u };	// bytes of all the memory blocks
+		std::size_t mNodesInUse{ 0u };		// nodes handed out
+		std::size_t mNodesFree{ 0u };		// nodes in the free list
+		std::size_t mHighWater{ 0u };		// maximum of mNodesInUse so far; added up: the highest pool's
+
+		PoolStats& operator+=(const PoolStats& other) noexcept
+		{
+			mBlocks += other.mBlocks;
+			mBytesReserved += other.mBytesReserved;
+			mNodesInUse += other.mNodesInUse;
+			mNodesFree += other.mNodesFree;
+			mHighWater = std::max(mHighWater, other.mHighWater);	// the peaks of pools are not simultaneous
+			return *this;
+		}
+	};
+
+	// TEMPLATE CLASS FixedPool
+	template<std::size_t SizeBytes, std::size_t Align = alignof(std::max_align_t)> class FixedPool final
+	{
+	public:
+		using size_type = std::size_t;
+
+		// Alignment and size of one memory node (big enough to hold a free list link)
+		static constexpr size_type node_align = Align > alignof(void*) ? Align : alignof(void*);
+		static constexpr size_type node_size =
+			((SizeBytes > sizeof(void*) ? SizeBytes : sizeof(void*)) + node_align - 1u) / node_align * node_align;
+
+	private:
+		// Header in front of each memory block, padded to keep the nodes aligned
+		struct alignas(node_align) BlockHeader final
+		{
+			BlockHeader* mNextBlock{ nullptr };
+			bool mFromArena{ false };
+		};
+
+		// Link of the free list, placed in the memory of a free node
+		struct FreeNode final
+		{
+			FreeNode* mNextFree{ nullptr };
+		};
+
+		BlockHeader* mBlockPtr;
+		FreeNode* mStorePtr;
+		size_type mCapacity;
+		MmapArena* mArenaPtr;
+		size_type mBlocks;
+		size_type mInUse;
+		size_type mHighWater;
+
+	private:
+		// Allocate raw memory respecting the node alignment. May throw std::bad_alloc
+		static void* allocateMemory(size_type bytes)
+		{
+			if constexpr (node_align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			{
+				return ::operator new(bytes, std::align_val_t{ node_align });
+			}
+			else
+			{
+				return NEW_MEMORY(bytes);
+			}
+		}
+
+		// Free raw memory allocated by allocateMemory()
+		static void freeMemory(void* address) noexcept
+		{
+			if constexpr (node_align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+			{
+				::operator delete(address, std::align_val_t{ node_align });
+			}
+			else
+			{
+				DELETE_MEMORY(address);
+			}
+		}
+
+		// Expand memory by allocating new memory block. This May throw exception if memory allocation fails
+		void expandMemory()
+		{
+			const size_type bytes = blockBytes();
+			void* memory = mArenaPtr ? mArenaPtr->allocate(bytes, alignof(BlockHeader)) : nullptr;
+			const bool fromArena = memory != nullptr;
+
+			BlockHeader* newMemoryBlock = ::new(fromArena ? memory : allocateMemory(bytes))
+				BlockHeader{ mBlockPtr, fromArena };
+			mBlockPtr = newMemoryBlock;
+			++mBlocks;
+
+			// thread the nodes of the block into the free list, in address order
+			unsigned char* firstNode = reinterpret_cast<unsigned char*>(newMemoryBlock + 1);
+			for (size_type index = mCapacity; index-- > 0u;)
+			{
+				mStorePtr = ::new(firstNode + index * node_size) FreeNode{ mStorePtr };
+			}
+		}
+
+		// Free all allocated memory blocks
+		void clearMemory() noexcept
+		{
+			while (mBlockPtr)
+			{
+				BlockHeader* block = std::exchange(mBlockPtr, mBlockPtr->mNextBlock);
+				if (!block->mFromArena) // arena memory is released with the arena
+				{
+					freeMemory(block);
+				}
+			}
+			mStorePtr = nullptr;
+			mBlocks = mInUse = 0u;
+		}
+
+		// Bytes of one memory block
+		size_type blockBytes() const noexcept
+		{
+			return sizeof(BlockHeader) + node_size * mCapacity;
+		}
+
+	public:
+		// Construct FixedPool with number of nodes per memory block. Allocates nothing up front.
+		// Memory blocks come from the arena (if any) while it has room, then from the heap.
+		explicit FixedPool(size_type capacity = 64u, MmapArena* arena = nullptr) noexcept
+			: mBlockPtr{ nullptr }
+			, mStorePtr{ nullptr }
+			, mCapacity{ capacity >= 1u ? capacity : 1u }
+			, mArenaPtr{ arena }
+			, mBlocks{ 0u }
+			, mInUse{ 0u }
+			, mHighWater{ 0u }
+		{}
+
+		// Copy-construct FixedPool
+		FixedPool(const FixedPool&) = delete;
+
+		// Copy-assignment FixedPool
+		FixedPool& operator=(const FixedPool&) = delete;
+
+		// Move-construct FixedPool. The moved-from pool stays usable.
+		FixedPool(FixedPool&& other) noexcept
+			: mBlockPtr{ std::exchange(other.mBlockPtr, nullptr) }
+			, mStorePtr{ std::exchange(other.mStorePtr, nullptr) }
+			, mCapacity{ other.mCapacity }
+			, mArenaPtr{ std::exchange(other.mArenaPtr, nullptr) }
+			, mBlocks{ std::exchange(other.mBlocks, 0u) }
+			, mInUse{ std::exchange(other.mInUse, 0u) }
+			, mHighWater{ std::exchange(other.mHighWater, 0u) }
+		{}
+
+		// Move-assignment FixedPool
+		FixedPool& operator=(FixedPool&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clearMemory();
+				mBlockPtr = std::exchange(other.mBlockPtr, nullptr);
+				mStorePtr = std::exchange(other.mStorePtr, nullptr);
+				mCapacity = other.mCapacity;
+				mArenaPtr = std::exchange(other.mArenaPtr, nullptr);
+				mBlocks = std::exchange(other.mBlocks, 0u);
+				mInUse = std::exchange(other.mInUse, 0u);
+				mHighWater = std::exchange(other.mHighWater, 0u);
+			}
+			return *this;
+		}
+
+		// Destroy FixedPool. All the nodes are released, used or not.
+		~FixedPool() noexcept
+		{
+			clearMemory();
+		}
+
+		// Make sure one memory block is available. May throw exception if memory allocation fails
+		void reserve()
+		{
+			if (!mStorePtr)
+			{
+				expandMemory(); // May throw
+			}
+		}
+
+		// Allocate one node; It may throw exception if memory allocation fails
+		[[nodiscard]] void* allocate()
+		{
+			reserve(); // May throw
+			if (++mInUse > mHighWater)
+			{
+				mHighWater = mInUse;
+			}
+			return std::exchange(mStorePtr, mStorePtr->mNextFree);
+		}
+
+		// Deallocate previously allocated node
+		void deallocate(void* address) noexcept
+		{
+			mStorePtr = ::new(address) FreeNode{ mStorePtr };
+			--mInUse;
+		}
+
+		// Memory statistics of the pool
+		PoolStats stats() const noexcept
+		{
+			return PoolStats{ mBlocks, mBlocks * blockBytes(), mInUse, mBlocks * mCapacity - mInUse, mHighWater };
+		}
+
+		// Number of nodes per memory block
+		size_type capacity() const noexcept
+		{
+			return mCapacity;
+		}
+	};
+
+	namespace internal
+	{
+		// TEMPLATE CLASS SharedFixedPool: FixedPool guarded by a SlimLock
+		template<std::size_t SizeBytes, std::size_t Align> class SharedFixedPool final
+		{
+		private:
+			FixedPool<SizeBytes, Align> mPool;
+			SlimLock mLock;
+
+		public:
+			// Construct SharedFixedPool
+			explicit SharedFixedPool(std::size_t capacity) noexcept
+				: mPool{ capacity }
+				, mLock{}
+			{}
+
+			// Allocate one node; It may throw exception if memory allocation fails
+			[[nodiscard]] void* allocate()
+			{
+				const AutoLock guard{ mLock };
+				return mPool.allocate();
+			}
+
+			// Deallocate previously allocated node
+			void deallocate(void* address) noexcept
+			{
+				const AutoLock guard{ mLock };
+				mPool.deallocate(address);
+			}
+
+			// Memory statistics of the pool
+			PoolStats stats()
+			{
+				const AutoLock guard{ mLock };
+				return mPool.stats();
+			}
+		};
+	}
+
+	// Pool flavours of PoolAllocator
+	enum class PoolMode : char { Shared = 1, ThreadLocal = 2 };
+
+	// TEMPLATE CLASS PoolAllocator (not final: containers derive from their allocator)
+	template<typename Type, PoolMode Mode = PoolMode::Shared> class PoolAllocator
+	{
+	public:
+		using value_type = Type;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
+		template<typename Other> struct rebind final
+		{
+			using other = PoolAllocator<Other, Mode>;
+		};
+
+	private:
+		// Pool of the node size: shared by all the types of the same size and alignment
+		static auto& pool()
+		{
+			constexpr std::size_t capacity = 4096u / FixedPool<sizeof(Type), alignof(Type)>::node_size;
+
+			if constexpr (Mode == PoolMode::ThreadLocal)
+			{
+				thread_local FixedPool<sizeof(Type), alignof(Type)> instance{ capacity };
+				return instance;
+			}
+			else
+			{
+				// intentionally never destroyed: containers with static storage may outlive it
+				static auto* const instance = new internal::SharedFixedPool<sizeof(Type), alignof(Type)>{ capacity };
+				return *instance;
+			}
+		}
+
+	public:
+		// Construct PoolAllocator
+		constexpr PoolAllocator() noexcept = default;
+
+		// Construct PoolAllocator from an allocator of other type (rebind)
+		template<typename Other>
+		constexpr PoolAllocator(const PoolAllocator<Other, Mode>&) noexcept
+		{}
+
+		// Allocate memory for count objects. May throw std::bad_alloc
+		[[nodiscard]] Type* allocate(size_type count)
+		{
+			if (count == 1u)
+			{
+				return static_cast<Type*>(pool().allocate());
+			}
+			return std::allocator<Type>{}.allocate(count);
+		}
+
+		// Deallocate memory previously allocated by allocate(count)
+		void deallocate(Type* address, size_type count) noexcept
+		{
+			if (count == 1u)
+			{
+				pool().deallocate(address);
+			}
+			else
+			{
+				std::allocator<Type>{}.deallocate(address, count);
+			}
+		}
+
+		// Memory statistics of the pool (of the calling thread, in ThreadLocal mode)
+		static PoolStats stats()
+		{
+			return pool().stats();
+		}
+
+		// All the allocators of the same mode share the pools
+		template<typename Other>
+		constexpr bool operator==(const PoolAllocator<Other, Mode>&) const noexcept
+		{
+			return true;
+		}
+
+		template<typename Other>
+		constexpr bool operator!=(const PoolAllocator<Other, Mode>&) const noexcept
+		{
+			return false;
+		}
+	};
+}
+
+#endif // JEJO_POOL_ALLOCATOR_T_HPP
+
+/*****************************************************************************/
@@ -0,0 +1,235 @@
+/******************************************************************************
+ * RoutedSignal - Signal whose slots subscribe to a routing key (e.g. one
+ * instrument id), or to all the keys. An emission for a key calls the slots
+ * of that key and the wildcard ones only: no call into the slots of the
+ * other keys, which would check the arguments and return.
+ *
+ * The slots of a key form one Signal, found through a fixed size open
+ * addressing table (linear probing). The emissions read the table without a
+ * lock; connect() adds a key under a lock. The keys stay in the table once
+ * added (their Signals may get empty), so the table holds as many keys as the
+ * constructor was told; one more throws std::length_error.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_ROUTED_SIGNAL_T_HPP
+#define JEJO_ROUTED_SIGNAL_T_HPP
+
+ // C++ headers
+#include <atomic>		// std::atomic<>
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint32_t
+#include <functional>	// std::hash<>
+#include <memory>		// std::unique_ptr<>
+#include <stdexcept>	// std::length_error
+#include <utility>		// std::forward<>()
+
+// own JeJo-lib headers
+#include "SignalsT.hpp"
+#include "LockClassesT.hpp"
+
+namespace JeJo
+{
+	// TEMPLATE CLASS RoutedSignal
+	template<typename Signature, typename KeyType = std::uint32_t> class RoutedSignal;
+
+	template<typename... Args, typename KeyType> class RoutedSignal<void(Args...), KeyType> final
+	{
+	public:
+		using size_type = std::size_t;
+		using SignalType = Signal<void(Args...)>;
+
+	private:
+		// Entry of the table; the key is written once, before the Signal is published
+		struct Bucket final
+		{
+			KeyType mKey{};
+			std::atomic<SignalType*> mSignal{ nullptr };
+		};
+
+		std::unique_ptr<Bucket[]> mp_buckets;
+		size_type m_mask;			// table size - 1 (a power of two)
+		size_type m_max_keys;
+		size_type m_keys;
+		size_type m_capacity;		// Storage capacity of the Signal of a key
+		SignalType m_any;			// wildcard slots
+		mutable internal::SlimLock m_write_lock;
+
+		// First bucket of the key
+		size_type home(const KeyType& key) const noexcept
+		{
+			// spread the (often sequential) integral hashes over the table
+			std::size_t hash = std::hash<KeyType>{}(key) * std::size_t{ 0x9E3779B97F4A7C15ull };
+			hash ^= hash >> 29u;
+			return hash & m_mask;
+		}
+
+		// Signal of the key, nullptr if the key has none
+		SignalType* find(const KeyType& key) const noexcept
+		{
+			for (size_type index = home(key), probes = 0u; probes <= m_mask; index = (index + 1u) & m_mask, ++probes)
+			{
+				SignalType* const signal = mp_buckets[index].mSignal.load(std::memory_order_acquire);
+				if (!signal)
+				{
+					return nullptr;
+				}
+				if (mp_buckets[index].mKey == key)
+				{
+					return signal;
+				}
+			}
+			return nullptr;
+		}
+
+		// Signal of the key, added if the key has none.
+		// Throws std::length_error if the table is full
+		// May throw exception if memory allocation fails
+		SignalType& add(const KeyType& key)
+		{
+			const internal::AutoLock guard{ m_write_lock };
+			size_type index = home(key);
+			for (;; index = (index + 1u) & m_mask)
+			{
+				Bucket& bucket = mp_buckets[index];
+				SignalType* const signal = bucket.mSignal.load(std::memory_order_relaxed);
+				if (!signal)
+				{
+					break;
+				}
+				if (bucket.mKey == key)
+				{
+					return *signal;
+				}
+			}
+
+			if (m_keys == m_max_keys)
+			{
+				throw std::length_error("RoutedSignal: too many keys");
+			}
+			auto signal = std::make_unique<SignalType>(m_capacity);
+			mp_buckets[index].mKey = key;
+			mp_buckets[index].mSignal.store(signal.get(), std::memory_order_release);
+			++m_keys;
+			return *signal.release();
+		}
+
+	public:
+		// Construct RoutedSignal for up to maxKeys keys; the Signal of each key
+		// gets the provided / default Storage capacity.
+		// May throw exception if memory allocation fails
+		explicit RoutedSignal(size_type maxKeys = 64, size_type capacity = 5)
+			: mp_buckets{ nullptr }
+			, m_mask{ 0u }
+			, m_max_keys{ maxKeys }
+			, m_keys{ 0u }
+			, m_capacity{ capacity }
+			, m_any{ capacity }
+			, m_write_lock{}
+		{
+			// at most half full: short probe sequences
+			size_type buckets = 2u;
+			while (buckets < 2u * maxKeys)
+			{
+				buckets *= 2u;
+			}
+			mp_buckets.reset(new Bucket[buckets]);
+			m_mask = buckets - 1u;
+		}
+
+		// Deleted copy-constructor
+		RoutedSignal(const RoutedSignal&) = delete;
+
+		// Deleted copy-assignment operator
+		RoutedSignal& operator=(const RoutedSignal&) = delete;
+
+		// Destroy RoutedSignal
+		~RoutedSignal() noexcept
+		{
+			for (size_type index = 0u; index <= m_mask; ++index)
+			{
+				delete mp_buckets[index].mSignal.load();
+			}
+		}
+
+		// Connect a slot (the arguments of Signal::connect()) to the key.
+		// Throws std::length_error if the key is new and the table is full
+		// May throw exception if memory allocation fails
+		template<typename... Targets>
+		bool connect(const KeyType& key, Targets&&... targets)
+		{
+			return add(key).connect(std::forward<Targets>(targets)...);
+		}
+
+		// Connect a slot (the arguments of Signal::connect()) to all the keys
+		// May throw exception if memory allocation fails
+		template<typename... Targets>
+		bool connect_any(Targets&&... targets)
+		{
+			return m_any.connect(std::forward<Targets>(targets)...);
+		}
+
+		// Disconnect a slot of the key; see Signal::disconnect()
+		template<typename... Targets>
+		bool disconnect(const KeyType& key, Targets&&... targets) noexcept
+		{
+			SignalType* const signal = find(key);
+			return signal && signal->disconnect(std::forward<Targets>(targets)...);
+		}
+
+		// Disconnect a slot of all the keys; see Signal::disconnect()
+		template<typename... Targets>
+		bool disconnect_any(Targets&&... targets) noexcept
+		{
+			return m_any.disconnect(std::forward<Targets>(targets)...);
+		}
+
+		// Emit RoutedSignal for the key: the slots of the key, then the wildcard ones
+		// May throw exception if some slot does
+		void emit(const KeyType& key, Args... args)
+		{
+			if (SignalType* const signal = find(key))
+			{
+				(*signal)(args...);
+			}
+			if (!m_any.empty())
+			{
+				m_any(args...);
+			}
+		}
+
+		// Emit RoutedSignal for the key: the slots of the key, then the wildcard ones
+		// May throw exception if some slot does
+		void operator()(const KeyType& key, Args... args)
+		{
+			emit(key, args...);
+		}
+
+		// Get number of slots connected to the key (the wildcard ones aside)
+		size_type size(const KeyType& key) const noexcept
+		{
+			const SignalType* const signal = find(key);
+			return signal ? signal->size() : 0u;
+		}
+
+		// Get number of wildcard slots
+		size_type size_any() const noexcept
+		{
+			return m_any.size();
+		}
+
+		// Get number of keys in the table
+		size_type keys() const noexcept
+		{
+			const internal::AutoLock guard{ m_write_lock };
+			return m_keys;
+		}
+	};
+}
+
+#endif // JEJO_ROUTED_SIGNAL_T_HPP
+
+/*****************************************************************************/
@@ -0,0 +1,283 @@
+/******************************************************************************
+ * Signal operators - Lazy composition of processing stages on Signals:
+ *
+ *		JeJo::Subscription subscription = signal
+ *			| JeJo::filter([](int value) { return value > 0; })
+ *			| JeJo::map([](int value) { return value * 0.5; })
+ *			| JeJo::sink(&object, &Object::onValue);
+ *
+ * The stages are only collected until the sink: then they are fused into one
+ * functor, with every stage inlined into the next, and connected to the
+ * source Signal(s) as one slot. A chain of stages costs one slot call, not
+ * one emission, list walk and indirect call per stage.
+ *
+ * merge(signal_a, signal_b, ...) feeds one chain from several Signals of the
+ * same signature. The Subscription owns the chain: destroying it disconnects
+ * the chain from all its sources (the chain is a Trackable, with the same
+ * rule: no emission of a source may be running then). The sources are
+ * Signals of void signatures; map() stages pass one value on.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_SIGNAL_OPERATORS_T_HPP
+#define JEJO_SIGNAL_OPERATORS_T_HPP
+
+ // C++ headers
+#include <array>		// std::array<>
+#include <cstddef>		// std::size_t
+#include <functional>	// std::invoke()
+#include <memory>		// std::unique_ptr<>
+#include <tuple>		// std::tuple<>, std::get<>(), std::tuple_cat()
+#include <type_traits>	// std::decay_t<>, std::is_same_v<>, std::enable_if_t<>
+#include <utility>		// std::move(), std::forward<>()
+
+// own JeJo-lib headers
+#include "SignalsT.hpp"
+
+namespace JeJo
+{
+	namespace internal
+	{
+		// Stage passing the values on if the predicate holds
+		template<typename Predicate>
+		struct FilterStage final
+		{
+			Predicate mPredicate;
+
+			template<typename Next, typename... Values>
+			void operator()(Next& next, Values&... values)
+			{
+				if (std::invoke(mPredicate, values...))
+				{
+					next(values...);
+				}
+			}
+		};
+
+		// Stage passing the result of the function on
+		template<typename Function>
+		struct MapStage final
+		{
+			Function mFunction;
+
+			template<typename Next, typename... Values>
+			void operator()(Next& next, Values&... values)
+			{
+				auto result = std::invoke(mFunction, values...);
+				next(result);
+			}
+		};
+
+		// Last stage: the function / method receiving the values
+		template<typename Function>
+		struct SinkStage final
+		{
+			Function mFunction;
+		};
+
+		// Method of an object, as a sink function
+		template<typename ClassType, typename MethodType>
+		struct MethodSink final
+		{
+			ClassType* mObject;
+			MethodType mMethod;
+
+			template<typename... Values>
+			void operator()(Values&... values) const
+			{
+				std::invoke(mMethod, mObject, values...);
+			}
+		};
+
+		// Base of the fused chains owned by a Subscription
+		class Subscriber : public Trackable
+		{
+		public:
+			// Destroy Subscriber
+			virtual ~Subscriber() noexcept = default;
+		};
+
+		// Stages and sink fused into one functor, connected to the sources
+		template<typename Sink, typename... Stages>
+		class FusedChain final : public Subscriber
+		{
+		private:
+			std::tuple<Stages...> mStages;
+			Sink mSink;
+
+			// Run the stages from the index on, each one inlined into the previous
+			template<std::size_t Index, typename... Values>
+			void run(Values&... values)
+			{
+				if constexpr (Index == sizeof...(Stages))
+				{
+					std::invoke(mSink, values...);
+				}
+				else
+				{
+					auto next = [this](auto&... output) { run<Index + 1u>(output...); };
+					std::get<Index>(mStages)(next, values...);
+				}
+			}
+
+		public:
+			// Construct FusedChain
+			FusedChain(std::tuple<Stages...>&& stages, Sink&& sink)
+				: mStages{ std::move(stages) }
+				, mSink{ std::move(sink) }
+			{}
+
+			// Destroy FusedChain: disconnect before the stages go
+			~FusedChain() noexcept override
+			{
+				disconnect_tracked();
+			}
+
+			// Run the chain for one emission
+			template<typename... Values>
+			void operator()(Values&... values)
+			{
+				run<0u>(values...);
+			}
+		};
+
+		// Sources and stages collected so far; fused at the sink
+		template<typename SignalType, std::size_t Sources, typename... Stages>
+		class Pipe final
+		{
+		public:
+			std::array<SignalType*, Sources> mSources;
+			std::tuple<Stages...> mStages;
+		};
+
+		template<typename Type> struct IsStage : std::false_type {};
+		template<typename Predicate> struct IsStage<FilterStage<Predicate>> : std::true_type {};
+		template<typename Function> struct IsStage<MapStage<Function>> : std::true_type {};
+
+		template<typename Type> struct IsVoidSignal : std::false_type {};
+		template<typename... Args> struct IsVoidSignal<Signal<void(Args...)>> : std::true_type {};
+	}
+
+	// Owner of a fused chain, disconnects it from its sources when destroyed
+	class Subscription final
+	{
+	private:
+		std::unique_ptr<internal::Subscriber> mChain;
+
+	public:
+		// Construct Subscription (empty)
+		Subscription() noexcept = default;
+
+		// Construct Subscription owning the chain
+		explicit Subscription(std::unique_ptr<internal::Subscriber> chain) noexcept
+			: mChain{ std::move(chain) }
+		{}
+
+		// Move-construct Subscription
+		Subscription(Subscription&&) noexcept = default;
+
+		// Move-assign Subscription, disconnects the own chain
+		Subscription& operator=(Subscription&&) noexcept = default;
+
+		// Disconnect the chain from its sources
+		void reset() noexcept
+		{
+			mChain.reset();
+		}
+
+		// Number of sources the chain is connected to
+		std::size_t connected() const noexcept
+		{
+			return mChain ? mChain->tracked() : 0u;
+		}
+
+		// Check whether Subscription owns a chain
+		explicit operator bool() const noexcept
+		{
+			return static_cast<bool>(mChain);
+		}
+	};
+
+	// Stage: pass the values on if the predicate holds
+	template<typename Predicate>
+	internal::FilterStage<std::decay_t<Predicate>> filter(Predicate&& predicate)
+	{
+		return { std::forward<Predicate>(predicate) };
+	}
+
+	// Stage: pass the result of the function on
+	template<typename Function>
+	internal::MapStage<std::decay_t<Function>> map(Function&& function)
+	{
+		return { std::forward<Function>(function) };
+	}
+
+	// Sink: function / functor receiving the values
+	template<typename Function>
+	internal::SinkStage<std::decay_t<Function>> sink(Function&& function)
+	{
+		return { std::forward<Function>(function) };
+	}
+
+	// Sink: method of the object receiving the values (the object must outlive the Subscription)
+	template<typename ClassType, typename MethodType>
+	internal::SinkStage<internal::MethodSink<ClassType, MethodType>> sink(ClassType* object, MethodType method)
+	{
+		return { internal::MethodSink<ClassType, MethodType>{ object, method } };
+	}
+
+	// Source: several Signals of the same signature feeding one chain
+	template<typename SignalType, typename... SignalTypes>
+	internal::Pipe<SignalType, 1u + sizeof...(SignalTypes)> merge(SignalType& first, SignalTypes&... others)
+	{
+		static_assert((std::is_same_v<SignalType, SignalTypes> && ...), "merged Signals need the same signature");
+		return { { &first, &others... }, {} };
+	}
+
+	// Start a pipe on a Signal with a stage (filter() / map(); kept by value)
+	template<typename... Args, typename Stage>
+	std::enable_if_t<internal::IsStage<std::decay_t<Stage>>::value, internal::Pipe<Signal<void(Args...)>, 1u, std::decay_t<Stage>>>
+		operator|(Signal<void(Args...)>& source, Stage&& stage)
+	{
+		return { { &source }, std::tuple<std::decay_t<Stage>>{ std::forward<Stage>(stage) } };
+	}
+
+	// Add a stage to a pipe (filter() / map(); kept by value)
+	template<typename SignalType, std::size_t Sources, typename... Stages, typename Stage>
+	std::enable_if_t<internal::IsStage<std::decay_t<Stage>>::value, internal::Pipe<SignalType, Sources, Stages..., std::decay_t<Stage>>>
+		operator|(internal::Pipe<SignalType, Sources, Stages...>&& pipe, Stage&& stage)
+	{
+		return { pipe.mSources, std::tuple_cat(std::move(pipe.mStages), std::tuple<std::decay_t<Stage>>{ std::forward<Stage>(stage) }) };
+	}
+
+	// End a pipe with a sink: fuse the stages and connect them to the sources.
+	// May throw exception if memory allocation fails
+	template<typename SignalType, std::size_t Sources, typename... Stages, typename Function>
+	[[nodiscard]] Subscription operator|(internal::Pipe<SignalType, Sources, Stages...>&& pipe, internal::SinkStage<Function>&& sink)
+	{
+		static_assert(internal::IsVoidSignal<SignalType>::value, "the sources are Signals of void signatures");
+		using ChainType = internal::FusedChain<Function, Stages...>;
+
+		auto chain = std::make_unique<ChainType>(std::move(pipe.mStages), std::move(sink.mFunction));
+		for (SignalType* const source : pipe.mSources)
+		{
+			source->connect(chain.get());
+		}
+		return Subscription{ std::move(chain) };
+	}
+
+	// Connect a sink to a Signal, without stages
+	// May throw exception if memory allocation fails
+	template<typename... Args, typename Function>
+	[[nodiscard]] Subscription operator|(Signal<void(Args...)>& source, internal::SinkStage<Function>&& sink)
+	{
+		return internal::Pipe<Signal<void(Args...)>, 1u>{ { &source }, {} } | std::move(sink);
+	}
+}
+
+#endif // JEJO_SIGNAL_OPERATORS_T_HPP
+
+/*****************************************************************************/
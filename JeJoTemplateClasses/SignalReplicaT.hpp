@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Signal replicas - Thread-local copies of the slots of the Signals in
+ * replicated mode (Signal::replicate()).
+ *
+ * An emission in replicated mode calls the slots out of the copy of its
+ * thread: no ReadGuard counter, no walk over the shared Connection nodes.
+ * The Signal counts its slot changes (a version); the emission compares the
+ * version of its copy with one relaxed load and copies the slots again only
+ * after a connect / disconnect. Emissions on different cores then share no
+ * written cache line (but the weak_ptr control blocks of trackable slots).
+ *
+ * The copies of a thread form a small direct-mapped cache per signature,
+ * indexed by a Signal id never reused: Signals colliding in it evict each
+ * other (one copy more per emission then). Copies of gone Signals stay until
+ * evicted or until the thread exits.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_SIGNAL_REPLICA_T_HPP
+#define JEJO_SIGNAL_REPLICA_T_HPP
+
+ // C++ headers
+#include <array>		// std::array<>
+#include <atomic>		// std::atomic<>
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint64_t
+#include <vector>		// std::vector<>
+
+// own JeJo-lib headers
+#include "SlotT.hpp"
+
+namespace JeJo
+{
+	namespace internal
+	{
+		// Ids of the Signals (0: none), for the replica caches
+		inline std::atomic<std::uint64_t> signal_serial{ 0u };
+
+		inline constexpr std::size_t replica_cache_size = 16u;	// copies per thread and signature
+
+		// TEMPLATE CLASS Replica
+		// Copy of the slots of one Signal at one version
+		template<typename Signature> class Replica;
+
+		template<typename ReType, typename... Args> class Replica<ReType(Args...)> final
+		{
+		public:
+			// One slot; trackable slots keep their tracking pointer
+			struct Entry final
+			{
+				Slot<ReType(Args...)> mSlot;
+				TrackPtr mTrackPtr;
+				bool mTrackable;
+			};
+
+			std::uint64_t mSignal{ 0u };	// id of the Signal copied, 0: none
+			std::uint64_t mVersion{ 0u };
+			std::vector<Entry> mEntries{};
+			bool mShared{ false };			// one-shot slots: emit over the shared list
+			unsigned mDepth{ 0u };			// emissions of the thread using the copy
+		};
+
+		// Marks a Replica in use for the scope: nested emissions do not rebuild it
+		template<typename ReplicaType>
+		class ReplicaUse final
+		{
+		private:
+			ReplicaType& m_replica;
+
+		public:
+			// Construct ReplicaUse
+			explicit ReplicaUse(ReplicaType& replica) noexcept
+				: m_replica{ replica }
+			{
+				++m_replica.mDepth;
+			}
+
+			// Deleted copy-constructor
+			ReplicaUse(const ReplicaUse&) = delete;
+
+			// Deleted copy-assignment operator
+			ReplicaUse& operator=(const ReplicaUse&) = delete;
+
+			// Destroy ReplicaUse
+			~ReplicaUse() noexcept
+			{
+				--m_replica.mDepth;
+			}
+		};
+
+		// Replica of the calling thread for the Signal id (the slot of the id in the cache)
+		template<typename Signature>
+		Replica<Signature>& replica(std::uint64_t signal) noexcept
+		{
+			static thread_local std::array<Replica<Signature>, replica_cache_size> cache;
+			return cache[signal & (replica_cache_size - 1u)];
+		}
+	}
+}
+
+#endif // JEJO_SIGNAL_REPLICA_T_HPP
+
+/*****************************************************************************/
@@ -0,0 +1,259 @@
+/******************************************************************************
+ * SignalTransaction - Scope for batched, glitch-free emission over several
+ * related Signals. Emissions made through the transaction are buffered,
+ * repeated emissions of a Signal are coalesced (the latest arguments win),
+ * and every participating Signal is emitted once at commit, in dependency
+ * order: a Signal declared to depend on another is emitted after it.
+ *
+ * The transaction commits when it goes out of scope (or on commit()), on the
+ * thread owning it; it is not meant to be shared between threads. Left by an
+ * exception thrown in its scope, it rolls back instead: the buffered
+ * emissions are dropped. Emissions
+ * made through the transaction by the slots during the commit are buffered for
+ * the next commit. Signals without a declared dependency, or on a dependency
+ * cycle, keep their first emission order. The participating Signals must
+ * outlive the transaction.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_SIGNAL_TRANSACTION_T_HPP
+#define JEJO_SIGNAL_TRANSACTION_T_HPP
+
+ // C++ headers
+#include <cstddef>		// std::size_t
+#include <exception>	// std::uncaught_exceptions()
+#include <memory>		// std::unique_ptr<>, std::make_unique<>()
+#include <tuple>		// std::tuple<>, std::apply()
+#include <type_traits>	// std::decay_t<>
+#include <utility>		// std::pair<>, std::forward<>()
+#include <vector>		// std::vector<>
+
+// own JeJo-lib headers
+#include "SignalsT.hpp"
+
+namespace JeJo
+{
+	namespace internal
+	{
+		// Buffered emission of one Signal
+		class PendingEmission
+		{
+		public:
+			const void* const mSignal;
+
+			// Construct PendingEmission
+			explicit PendingEmission(const void* signal) noexcept
+				: mSignal{ signal }
+			{}
+
+			// Destroy PendingEmission
+			virtual ~PendingEmission() noexcept = default;
+
+			// Emit the Signal with the buffered arguments
+			virtual void deliver() = 0;
+		};
+
+		template<typename ResT, typename ... ArgTs> class PendingEmissionT;
+
+		template<typename ReType, typename... Args> class PendingEmissionT<ReType(Args...)> final
+			: public PendingEmission
+		{
+		public:
+			using SignalType = Signal<ReType(Args...)>;
+			using ArgsType = std::tuple<std::decay_t<Args>...>;
+
+			ArgsType mArgs;
+
+			// Construct PendingEmissionT
+			template<typename... ArgTypes>
+			PendingEmissionT(SignalType& signal, ArgTypes&&... args)
+				: PendingEmission{ &signal }
+				, mArgs{ std::forward<ArgTypes>(args)... }
+			{}
+
+			// Emit the Signal with the buffered arguments
+			void deliver() override
+			{
+				SignalType& signal = *static_cast<SignalType*>(const_cast<void*>(mSignal));
+				std::apply([&signal](auto&... args) { signal(args...); }, mArgs);
+			}
+		};
+	}
+
+	class SignalTransaction final
+	{
+	private:
+		using size_type = std::size_t;
+		using PendingPtr = std::unique_ptr<internal::PendingEmission>;
+
+		std::vector<PendingPtr> mPending;	// first emission order
+		std::vector<std::pair<const void*, const void*>> mDependencies;	// (dependent, dependency)
+		size_type mEmissions{ 0u };
+		const int mUncaught{ std::uncaught_exceptions() };	// at construction
+
+		// Index of the buffered emission of the Signal, mPending.size() if none
+		size_type find(const void* signal) const noexcept
+		{
+			size_type index = 0u;
+			while (index < mPending.size() && mPending[index]->mSignal != signal)
+			{
+				++index;
+			}
+			return index;
+		}
+
+		// Order of delivery of the buffered emissions (Kahn's algorithm,
+		// picking the earliest emitted of the ready ones first)
+		std::vector<size_type> delivery_order() const
+		{
+			const size_type count = mPending.size();
+			std::vector<size_type> waiting(count, 0u);
+			std::vector<std::pair<size_type, size_type>> edges; // (dependency, dependent)
+
+			for (const auto& [dependent, dependency] : mDependencies)
+			{
+				const size_type from = find(dependency), to = find(dependent);
+				if (from < count && to < count && from != to)
+				{
+					edges.emplace_back(from, to);
+					++waiting[to];
+				}
+			}
+
+			std::vector<size_type> order;
+			std::vector<bool> delivered(count, false);
+			order.reserve(count);
+
+			while (order.size() < count)
+			{
+				size_type next = 0u;
+				while (next < count && (delivered[next] || waiting[next]))
+				{
+					++next;
+				}
+				if (next == count)
+				{
+					// dependency cycle: the earliest emitted of the rest goes next
+					next = 0u;
+					while (delivered[next])
+					{
+						++next;
+					}
+				}
+
+				delivered[next] = true;
+				order.push_back(next);
+				for (const auto& [from, to] : edges)
+				{
+					if (from == next && waiting[to])
+					{
+						--waiting[to];
+					}
+				}
+			}
+			return order;
+		}
+
+	public:
+		// Construct SignalTransaction
+		SignalTransaction() = default;
+
+		// Deleted copy-constructor
+		SignalTransaction(const SignalTransaction&) = delete;
+
+		// Deleted copy-assignment operator
+		SignalTransaction& operator=(const SignalTransaction&) = delete;
+
+		// Destroy SignalTransaction, commit the buffered emissions, or roll
+		// them back if an exception is unwinding the scope of the transaction.
+		// A slot throwing here terminates the program: commit() explicitly
+		// if the slots may throw.
+		~SignalTransaction() noexcept
+		{
+			if (std::uncaught_exceptions() > mUncaught)
+			{
+				rollback();
+			}
+			else
+			{
+				commit();
+			}
+		}
+
+		// Buffer an emission of the Signal; replaces the arguments of a
+		// previous one in this transaction (coalescing).
+		// May throw exception if memory allocation fails
+		template<typename ReType, typename... Args, typename... ArgTypes>
+		void emit(Signal<ReType(Args...)>& signal, ArgTypes&&... args)
+		{
+			using Pending = internal::PendingEmissionT<ReType(Args...)>;
+
+			++mEmissions;
+			const size_type index = find(&signal);
+			if (index < mPending.size())
+			{
+				static_cast<Pending&>(*mPending[index]).mArgs
+					= typename Pending::ArgsType{ std::forward<ArgTypes>(args)... };
+			}
+			else
+			{
+				mPending.push_back(std::make_unique<Pending>(signal, std::forward<ArgTypes>(args)...));
+			}
+		}
+
+		// Declare that the dependent Signal is emitted after the dependency one
+		// May throw exception if memory allocation fails
+		template<typename DependentType, typename DependencyType>
+		void depends(const Signal<DependentType>& dependent, const Signal<DependencyType>& dependency)
+		{
+			mDependencies.emplace_back(&dependent, &dependency);
+		}
+
+		// Emit the participating Signals once each, in dependency order, and
+		// start over with an empty transaction (the dependencies are kept).
+		// May throw exception if some slot does (the rest is then discarded)
+		void commit()
+		{
+			if (mPending.empty())
+			{
+				return;
+			}
+
+			const std::vector<size_type> order = delivery_order();
+			std::vector<PendingPtr> pending = std::move(mPending);
+			mPending.clear();
+			mEmissions = 0u;
+
+			for (const size_type index : order)
+			{
+				pending[index]->deliver();
+			}
+		}
+
+		// Drop the buffered emissions
+		void rollback() noexcept
+		{
+			mPending.clear();
+			mEmissions = 0u;
+		}
+
+		// Number of Signals to be emitted at commit
+		size_type size() const noexcept
+		{
+			return mPending.size();
+		}
+
+		// Number of emissions buffered, including the coalesced ones
+		size_type emissions() const noexcept
+		{
+			return mEmissions;
+		}
+	};
+}
+
+#endif // JEJO_SIGNAL_TRANSACTION_T_HPP
+
+/*****************************************************************************/
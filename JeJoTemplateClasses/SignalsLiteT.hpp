@@ -2,24 +2,42 @@
 #define SIGNALS_LITE_T_HPP
 
 #include <cstddef>		// std::size_t, std::nullptr_t
+#include <cstdint>		// std::uint32_t
 #include <utility>		// std::move(), std::forward<>()
-#include <algorithm>	// std::copy()
+#include <algorithm>	// std::copy(), std::max()
 #include <new>			// ::new()
 #include <atomic>		// std::atomic<>, std::atomic_flag
 #include <memory>		// std::shared_ptr<>, std::weak_ptr<>
 #include <thread>		// std::this_thread
+#include <stdexcept>	// std::length_error
+#include <type_traits>	// std::is_unsigned_v<>
+#include <vector>		// std::vector<>
 
 // Macros for dynamic memory allocation
 #define NEW_MEMORY(arg) ::operator new(arg)
 #define DELETE_MEMORY(arg) ::operator delete(arg)
 
+// TEMPLATE CLASS DenseSignal
+template<typename Signature, typename IndexType = unsigned short>
+class DenseSignal;
+
 // TEMPLATE CLASS Signal
-template<typename ResT, typename ... ArgTs>
+// IndexType: index of the connections (unsigned), e.g. unsigned int for more
+// than 65535 connections. InlineCapacity: connections stored in the Signal
+// itself, no heap allocation until more get connected.
+template<typename Signature, typename IndexType = unsigned short, std::size_t InlineCapacity = 0>
 class Signal;
 
-template<typename ResT, typename ... ArgTs>
-class Signal<ResT(ArgTs...)> final
+// Signal with N connections stored inline (like a small vector)
+template<typename Signature, std::size_t N, typename IndexType = unsigned short>
+using SignalLite = Signal<Signature, IndexType, N>;
+
+template<typename ResT, typename ... ArgTs, typename IndexType, std::size_t InlineCapacity>
+class Signal<ResT(ArgTs...), IndexType, InlineCapacity> final
 {
+	static_assert(std::is_unsigned_v<IndexType>, "IndexType must be an unsigned integral type");
+	static_assert(InlineCapacity < static_cast<IndexType>(-1), "InlineCapacity exceeds IndexType");
+
 	// Unified function pointer wrapper. Instances of SlotFunctor
 	// can store, copy, and invoke any callable target (slot).
 	class SlotFunctor;
@@ -29,10 +47,13 @@ class Signal<ResT(ArgTs...)> final
 	class Connection;
 
 	using Byte = unsigned char;
-	using size_type = unsigned short;
+	using size_type = IndexType;
 	using TrackPtr = std::weak_ptr<void>;
 
-	static const size_type null_index = ((size_type)-1);
+	static constexpr size_type null_index = ((size_type)-1);
+
+	// DenseSignal shares the SlotFunctor
+	template<typename, typename> friend class DenseSignal;
 
 	class SlotFunctor final
 	{
@@ -40,7 +61,7 @@ class Signal<ResT(ArgTs...)> final
 		template<typename Class, typename Signature>
 		struct TargetSlot
 		{
-			using Signature = Signature;
+			using SlotFunction = Signature;
 			using SlotInstance = Class * ;
 			SlotFunction mp_function;
 			SlotInstance mp_instance;
@@ -56,7 +77,7 @@ class Signal<ResT(ArgTs...)> final
 		using DefaultType = TargetSlot<DefaultClass, DefaultFunction>;
 
 		// Size of default target data
-		static const size_type target_size = sizeof(DefaultType);
+		static const std::size_t target_size = sizeof(DefaultType);
 
 		// Storage for target data
 		using SlotStorage = Byte[target_size];
@@ -167,7 +188,7 @@ class Signal<ResT(ArgTs...)> final
 		// Compare slot_functors (equal)
 		bool operator==(const SlotFunctor & other) const noexcept
 		{
-			for (size_type index = 0; index < target_size; ++index)
+			for (std::size_t index = 0; index < target_size; ++index)
 			{
 				if (m_target[index] != other.m_target[index])
 				{
@@ -180,7 +201,7 @@ class Signal<ResT(ArgTs...)> final
 		// Compare slot_functors (not equal)
 		bool operator!=(const SlotFunctor & other) const noexcept
 		{
-			for (size_type index = 0; index < target_size; ++index)
+			for (std::size_t index = 0; index < target_size; ++index)
 			{
 				if (m_target[index] != other.m_target[index])
 				{
@@ -208,7 +229,8 @@ class Signal<ResT(ArgTs...)> final
 			: m_slot(slot),
 			m_track_ptr(t_ptr),
 			m_next(null_index),
-			m_trackable(trackable)
+			m_trackable(trackable),
+			m_removed(false)
 		{}
 
 		// Copy-construct Connection
@@ -216,7 +238,17 @@ class Signal<ResT(ArgTs...)> final
 			: m_slot(other.m_slot),
 			m_track_ptr(other.m_track_ptr),
 			m_next(other.m_next),
-			m_trackable(other.m_trackable)
+			m_trackable(other.m_trackable),
+			m_removed(other.m_removed)
+		{}
+
+		// Move-construct Connection (no reference count update of the tracking pointer)
+		Connection(Connection && other) noexcept
+			: m_slot(other.m_slot),
+			m_track_ptr(std::move(other.m_track_ptr)),
+			m_next(other.m_next),
+			m_trackable(other.m_trackable),
+			m_removed(other.m_removed)
 		{}
 
 		// Destroy Connection
@@ -232,6 +264,7 @@ class Signal<ResT(ArgTs...)> final
 				m_track_ptr = other.m_track_ptr;
 				m_next = other.m_next;
 				m_trackable = other.m_trackable;
+				m_removed = other.m_removed;
 			}
 			return *this;
 		}
@@ -242,9 +275,112 @@ class Signal<ResT(ArgTs...)> final
 		TrackPtr		m_track_ptr;
 		size_type		m_next;
 		const bool		m_trackable;
+		bool			m_removed;	// disconnected during an emission, unlinked after it
+
+	};
+
+	// Connection requested during an emission, made after it
+	struct Pending
+	{
+		SlotFunctor	m_slot;
+		TrackPtr	m_track_ptr;
+		bool		m_trackable;
+	};
+
+	// Counts an emission for its scope
+	class EmitGuard final
+	{
+	public:
+
+		// Construct EmitGuard
+		explicit EmitGuard(Signal & signal) noexcept
+			: m_signal(signal)
+		{
+			++m_signal.m_emitting;
+		}
+
+		// Deleted copy-constructor
+		EmitGuard(const EmitGuard &) = delete;
+
+		// Deleted copy-assignment operator
+		EmitGuard & operator=(const EmitGuard &) = delete;
+
+		// Destroy EmitGuard
+		~EmitGuard() noexcept
+		{
+			--m_signal.m_emitting;
+		}
+
+	private:
+
+		Signal &	m_signal;
 
 	};
 
+	// Inline block of connections, nullptr without inline capacity
+	Connection * inline_block() noexcept
+	{
+		if constexpr (InlineCapacity > 0)
+		{
+			return reinterpret_cast<Connection*>(m_inline.m_bytes);
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	// Give the block of connections back, unless it is the inline one
+	void free_block() noexcept
+	{
+		if (mp_block != inline_block())
+		{
+			DELETE_MEMORY(mp_block);
+		}
+	}
+
+	// Reset to the empty initial block: the inline one, else none
+	void reset_storage() noexcept
+	{
+		mp_block = inline_block();
+		m_first_slot = null_index;
+		m_capacity = static_cast<size_type>(InlineCapacity);
+		m_store = InlineCapacity > 0 ? 0 : null_index;
+		if (mp_block)
+		{
+			init_storage(mp_block, m_capacity);
+		}
+	}
+
+	// Take over the connections of other, which gets reset; a heap block
+	// changes hands, inline connections get moved into the own inline block.
+	// The own block must be given back already.
+	void take(Signal & other) noexcept
+	{
+		if (other.mp_block && other.mp_block == other.inline_block())
+		{
+			mp_block = inline_block();
+			for (size_type index = other.m_first_slot; index != null_index; index = mp_block[index].m_next)
+			{
+				::new (mp_block + index) Connection(std::move(other.mp_block[index]));
+				other.mp_block[index].~Connection();
+			}
+			for (size_type index = other.m_store; index != null_index;
+				index = *reinterpret_cast<size_type*>(mp_block + index))
+			{
+				*reinterpret_cast<size_type*>(mp_block + index) = *reinterpret_cast<size_type*>(other.mp_block + index);
+			}
+		}
+		else
+		{
+			mp_block = other.mp_block;
+		}
+		m_first_slot = other.m_first_slot;
+		m_capacity = other.m_capacity;
+		m_store = other.m_store;
+		other.reset_storage();
+	}
+
 	// Initialize storage
 	void init_storage(Connection * address, size_type capacity) noexcept
 	{
@@ -256,11 +392,18 @@ class Signal<ResT(ArgTs...)> final
 		(*reinterpret_cast<size_type*>(address)) = null_index;
 	}
 
-	// Expand memory by allocating new memory block
+	// Expand memory by allocating new memory block; the connections get
+	// moved over (no reference count update of their tracking pointers).
+	// Throws std::length_error if IndexType can not index more connections
 	// May throw exception if memory allocation fails
 	void expand_storage()
 	{
-		size_type new_capacity = m_capacity * 2;
+		if (m_capacity == null_index)
+		{
+			throw std::length_error("Signal: too many connections for IndexType");
+		}
+		const std::size_t doubled = m_capacity >= 1 ? std::size_t{ m_capacity } * 2u : 1u;
+		const size_type new_capacity = doubled < null_index ? static_cast<size_type>(doubled) : null_index;
 		Connection * new_block = reinterpret_cast<Connection*>
 			(NEW_MEMORY(new_capacity * sizeof(Connection)));
 
@@ -269,11 +412,11 @@ class Signal<ResT(ArgTs...)> final
 
 		for (size_type index = 0; index < m_capacity; ++index)
 		{
-			::new (new_block + index) Connection(*(mp_block + index));
+			::new (new_block + index) Connection(std::move(*(mp_block + index)));
 			(mp_block + index)->~Connection();
 		}
 
-		DELETE_MEMORY(mp_block);
+		free_block();
 		m_capacity = new_capacity;
 		mp_block = new_block;
 	}
@@ -298,11 +441,31 @@ class Signal<ResT(ArgTs...)> final
 		m_store = index;
 	}
 
-	// Connect new slot to the Signal
+	// Connect new slot to the Signal; during an emission after it (no
+	// expand_storage() under the emission)
 	// May throw exception if memory allocation fails
 	bool connect(const SlotFunctor & slot,
 		const TrackPtr & t_ptr,
 		bool trackable)
+	{
+		if (m_emitting)
+		{
+			if (connected(slot))
+			{
+				return false;
+			}
+			m_pending.push_back(Pending{ slot, t_ptr, trackable });
+			return true;
+		}
+		apply_pending();
+		return link(slot, t_ptr, trackable);
+	}
+
+	// Link new slot into the list of the Signal
+	// May throw exception if memory allocation fails
+	bool link(const SlotFunctor & slot,
+		const TrackPtr & t_ptr,
+		bool trackable)
 	{
 		if (m_first_slot != null_index)
 		{
@@ -336,8 +499,86 @@ class Signal<ResT(ArgTs...)> final
 		}
 	}
 
-	// Disconnect slot from the Signal
+	// Disconnect slot from the Signal; during an emission the connection is
+	// marked only (the emission skips it) and unlinked after the emission
 	bool disconnect(const SlotFunctor & slot) noexcept
+	{
+		if (!m_emitting)
+		{
+			// connections left pending by a throwing slot are not linked yet
+			unlink_removed();
+			return unlink(slot) || erase_pending(slot);
+		}
+
+		for (size_type current = m_first_slot; current != null_index; current = mp_block[current].m_next)
+		{
+			if (!mp_block[current].m_removed && mp_block[current].m_slot == slot)
+			{
+				mp_block[current].m_removed = true;
+				++m_removed;
+				return true;
+			}
+		}
+		return erase_pending(slot);
+	}
+
+	// Drop the pending connection of slot, if any
+	bool erase_pending(const SlotFunctor & slot) noexcept
+	{
+		for (std::size_t index = 0; index < m_pending.size(); ++index)
+		{
+			if (m_pending[index].m_slot == slot)
+			{
+				m_pending.erase(m_pending.begin() + index);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Unlink the connections disconnected during the emissions
+	void unlink_removed() noexcept
+	{
+		if (!m_removed)
+		{
+			return;
+		}
+
+		size_type previous = null_index;
+		size_type current = m_first_slot;
+		while (current != null_index)
+		{
+			const size_type next = mp_block[current].m_next;
+			if (mp_block[current].m_removed)
+			{
+				(previous == null_index ? m_first_slot : mp_block[previous].m_next) = next;
+				mp_block[current].~Connection();
+				deallocate(current);
+			}
+			else
+			{
+				previous = current;
+			}
+			current = next;
+		}
+		m_removed = 0;
+	}
+
+	// Apply the disconnections and connections requested during the emissions
+	// May throw exception if memory allocation fails
+	void apply_pending()
+	{
+		unlink_removed();
+		// if link() throws, the ones linked already stay pending: link() skips them next time
+		for (const Pending & pending : m_pending)
+		{
+			link(pending.m_slot, pending.m_track_ptr, pending.m_trackable);
+		}
+		m_pending.clear();
+	}
+
+	// Unlink slot from the list of the Signal
+	bool unlink(const SlotFunctor & slot) noexcept
 	{
 		if (m_first_slot != null_index)
 		{
@@ -386,7 +627,7 @@ class Signal<ResT(ArgTs...)> final
 
 		while (current != null_index)
 		{
-			if (mp_block[current].m_slot == slot)
+			if (mp_block[current].m_slot == slot && !mp_block[current].m_removed)
 			{
 				return true;
 			}
@@ -396,73 +637,144 @@ class Signal<ResT(ArgTs...)> final
 			}
 		}
 
+		for (const Pending & pending : m_pending)
+		{
+			if (pending.m_slot == slot)
+			{
+				return true;
+			}
+		}
+
 		return false;
 	}
 
-	// Activate Signal
-	// May throw exception if some slot does
+	// Activate Signal. The slots may connect / disconnect (themselves or
+	// others) meanwhile: applied when the outermost emission ends.
+	// May throw exception if some slot (or memory allocation) does
 	void activate(ArgTs ... args)
 	{
 		if (!m_blocked)
 		{
-			size_type current = m_first_slot;
-
-			while (current != null_index)
+			if (!m_emitting && (m_removed || !m_pending.empty()))
 			{
-				if (!mp_block[current].m_trackable)
-				{
-					mp_block[current].m_slot(args...);
-					current = mp_block[current].m_next;
-				}
-				else
-				{
-					auto ptr = mp_block[current].m_track_ptr.lock();
+				apply_pending(); // left by a slot which threw; may throw
+			}
+			{
+				const EmitGuard guard(*this);
+				size_type current = m_first_slot;
 
-					if (ptr)
+				while (current != null_index)
+				{
+					if (mp_block[current].m_removed)
+					{
+						current = mp_block[current].m_next;
+					}
+					else if (!mp_block[current].m_trackable)
 					{
 						mp_block[current].m_slot(args...);
 						current = mp_block[current].m_next;
 					}
 					else
 					{
-						size_type to_delete = current;
-						current = mp_block[current].m_next;
-						disconnect(mp_block[to_delete].m_slot);
+						auto ptr = mp_block[current].m_track_ptr.lock();
+
+						if (ptr)
+						{
+							mp_block[current].m_slot(args...);
+							current = mp_block[current].m_next;
+						}
+						else
+						{
+							size_type to_delete = current;
+							current = mp_block[current].m_next;
+							disconnect(mp_block[to_delete].m_slot);
+						}
 					}
 				}
 			}
+
+			if (!m_emitting)
+			{
+				apply_pending(); // May throw
+			}
 		}
 	}
 
 public:
 
-	// Construct Signal with provided / default capacity
+	// Construct Signal with provided / default capacity; the inline block
+	// if it is big enough (no allocation)
 	// May throw exception if memory allocation fails
-	explicit Signal(size_type capacity = 5)
+	explicit Signal(size_type capacity = InlineCapacity > 0 ? InlineCapacity : 5)
 		: mp_block(nullptr),
 		m_first_slot(null_index),
 		m_capacity(capacity >= 1 ? capacity : 1),
 		m_store(0),
-		m_blocked(false)
+		m_blocked(false),
+		m_removed(0),
+		m_emitting(0),
+		m_pending()
 	{
-		mp_block = reinterpret_cast<Connection*>
-			(NEW_MEMORY(m_capacity * sizeof(Connection)));
+		if (m_capacity <= InlineCapacity)
+		{
+			m_capacity = static_cast<size_type>(InlineCapacity);
+			mp_block = inline_block();
+		}
+		else
+		{
+			mp_block = reinterpret_cast<Connection*>
+				(NEW_MEMORY(m_capacity * sizeof(Connection)));
+		}
 		init_storage(mp_block, m_capacity);
 	}
 
 	// Deleted copy-constructor
 	Signal(const Signal &)noexcept = delete;
 
+	// Move-construct Signal. Takes over the slots and the storage of other
+	// (inline connections get moved), other stays usable (empty).
+	// Must not be called from a slot of other.
+	Signal(Signal && other) noexcept
+		: mp_block(nullptr),
+		m_first_slot(null_index),
+		m_capacity(0),
+		m_store(null_index),
+		m_blocked(other.m_blocked),
+		m_removed(std::exchange(other.m_removed, 0)),
+		m_emitting(0),
+		m_pending(std::move(other.m_pending))
+	{
+		take(other);
+		other.m_pending.clear();
+	}
+
 	// Destroy Signal
 	~Signal() noexcept
 	{
 		disconnect_all();
-		DELETE_MEMORY(mp_block);
+		free_block();
 	}
 
 	// Deleted copy-assignment operator
 	Signal & operator=(const Signal &)noexcept = delete;
 
+	// Move-assign Signal. Disconnects the own slots and takes over the
+	// slots and the storage of other. Must not be called from a slot.
+	Signal & operator=(Signal && other) noexcept
+	{
+		if (this != &other)
+		{
+			disconnect_all();
+			free_block();
+			take(other);
+			m_blocked = other.m_blocked;
+			m_removed = std::exchange(other.m_removed, 0);
+			m_pending = std::move(other.m_pending);
+			other.m_pending.clear();
+		}
+		return *this;
+	}
+
 	// Connect Signal to slot (function)
 	// May throw exception if memory allocation fails
 	bool connect(ResT(*function)(ArgTs...))
@@ -536,9 +848,20 @@ public:
 		return disconnect(SlotFunctor(functor.get()));
 	}
 
-	// Disconnect Signal from all slots
+	// Disconnect Signal from all slots (during an emission: after it)
 	void disconnect_all() noexcept
 	{
+		m_pending.clear();
+		if (m_emitting)
+		{
+			for (size_type current = m_first_slot; current != null_index; current = mp_block[current].m_next)
+			{
+				m_removed += !mp_block[current].m_removed;
+				mp_block[current].m_removed = true;
+			}
+			return;
+		}
+
 		size_type to_delete = m_first_slot;
 
 		while (to_delete != null_index)
@@ -550,6 +873,7 @@ public:
 		}
 
 		m_first_slot = null_index;
+		m_removed = 0;
 	}
 
 	// Check whether slot is connected (function)
@@ -618,26 +942,511 @@ public:
 
 		while (current != null_index)
 		{
-			++size;
+			size += !mp_block[current].m_removed;
 			current = mp_block[current].m_next;
 		}
 
-		return size;
+		return static_cast<size_type>(size + m_pending.size());
 	}
 
 	// Check whether list of connected slots is empty
 	bool empty() const noexcept
 	{
-		return m_first_slot == null_index;
+		return m_removed ? size() == 0 : m_first_slot == null_index && m_pending.empty();
 	}
 
 private:
 
+	// Storage of the inline connections
+	struct InlineBlock
+	{
+		alignas(Connection) Byte m_bytes[InlineCapacity * sizeof(Connection)];
+	};
+
+	struct NoInlineBlock {};
+
 	Connection *	mp_block;
 	size_type		m_first_slot;
 	size_type		m_capacity;
 	size_type		m_store;
 	bool			m_blocked;
+	size_type		m_removed;		// connections marked removed during the emissions
+	unsigned		m_emitting;		// emissions running (nested ones included)
+	std::vector<Pending>	m_pending;	// connections requested during the emissions
+	[[no_unique_address]] std::conditional_t<(InlineCapacity > 0), InlineBlock, NoInlineBlock> m_inline;
+
+};
+
+// Signal keeping its connections packed in one array: emission is a linear
+// scan, connect() appends in O(1) (no duplicate check) and disconnecting moves
+// the last connection into the gap. The order of the slots is not kept.
+// Connections are addressed by handles, checked by a generation: the handle
+// of a disconnected slot stays invalid even if its index gets reused (until
+// the 32 bit generation of the index wraps around, whatever the IndexType).
+// Disconnections during an emission (by the slots, expired trackable slots)
+// are deferred until the emission ends.
+template<typename ResT, typename ... ArgTs, typename IndexType>
+class DenseSignal<ResT(ArgTs...), IndexType> final
+{
+	using SlotFunctor = typename Signal<ResT(ArgTs...), IndexType>::SlotFunctor;
+	using size_type = IndexType;
+	using TrackPtr = std::weak_ptr<void>;
+
+	static constexpr size_type null_index = ((size_type)-1);
+
+public:
+
+	// Generation of a handle index, counting its reuses; wider than a small IndexType
+	using generation_type = std::uint32_t;
+
+	// Handle of a connection
+	class Handle final
+	{
+	public:
+
+		// Check whether Handle was returned by connect()
+		explicit operator bool() const noexcept
+		{
+			return m_index != null_index;
+		}
+
+	public:
+
+		size_type		m_index{ null_index };
+		generation_type	m_generation{ 0 };
+
+	};
+
+private:
+
+	// Connection in the packed array
+	struct Entry
+	{
+		SlotFunctor	m_slot;
+		TrackPtr	m_track_ptr;
+		size_type	m_handle;		// index of its handle entry
+		bool		m_trackable;
+		bool		m_removed;		// disconnected during an emission
+	};
+
+	// Handle entry: position of the connection, null_index if free
+	struct HandleEntry
+	{
+		size_type		m_dense;
+		generation_type	m_generation;
+	};
+
+	// Counts an emission for its scope; the last one compacts the array
+	class EmitGuard final
+	{
+	public:
+
+		// Construct EmitGuard
+		explicit EmitGuard(DenseSignal & signal) noexcept
+			: m_signal(signal)
+		{
+			++m_signal.m_emitting;
+		}
+
+		// Deleted copy-constructor
+		EmitGuard(const EmitGuard &) = delete;
+
+		// Deleted copy-assignment operator
+		EmitGuard & operator=(const EmitGuard &) = delete;
+
+		// Destroy EmitGuard
+		~EmitGuard() noexcept
+		{
+			if (!--m_signal.m_emitting && m_signal.m_removed)
+			{
+				m_signal.compact();
+			}
+		}
+
+	private:
+
+		DenseSignal &	m_signal;
+
+	};
+
+	// Free the handle entry; its handles become invalid
+	void release(size_type handle) noexcept
+	{
+		++m_handles[handle].m_generation;
+		m_handles[handle].m_dense = null_index;
+		m_free.push_back(handle); // capacity reserved by connect()
+	}
+
+	// Remove the connection at the position: swap with the last one
+	void erase(size_type position) noexcept
+	{
+		const size_type last = static_cast<size_type>(m_dense.size() - 1);
+		if (position != last)
+		{
+			m_dense[position] = std::move(m_dense[last]);
+			if (!m_dense[position].m_removed)
+			{
+				m_handles[m_dense[position].m_handle].m_dense = position;
+			}
+		}
+		m_dense.pop_back();
+	}
+
+	// Disconnect the connection at the position, later during an emission
+	void remove(size_type position) noexcept
+	{
+		Entry & entry = m_dense[position];
+		if (entry.m_removed)
+		{
+			return;
+		}
+		release(entry.m_handle);
+		if (m_emitting)
+		{
+			entry.m_removed = true;
+			++m_removed;
+		}
+		else
+		{
+			erase(position);
+		}
+	}
+
+	// Erase the connections disconnected during the emissions
+	void compact() noexcept
+	{
+		for (size_type position = 0; position < m_dense.size();)
+		{
+			if (m_dense[position].m_removed)
+			{
+				erase(position);
+			}
+			else
+			{
+				++position;
+			}
+		}
+		m_removed = 0;
+	}
+
+	// Connect new slot to the Signal
+	// Throws std::length_error if IndexType can not index more connections
+	// May throw exception if memory allocation fails
+	Handle connect(const SlotFunctor & slot,
+		const TrackPtr & t_ptr,
+		bool trackable)
+	{
+		if (m_dense.size() >= null_index)
+		{
+			throw std::length_error("DenseSignal: too many connections for IndexType");
+		}
+
+		size_type handle = null_index;
+		if (!m_free.empty())
+		{
+			handle = m_free.back();
+			m_dense.push_back(Entry{ slot, t_ptr, handle, trackable, false });
+			m_free.pop_back();
+		}
+		else
+		{
+			// grow geometrically; m_free keeps room for every handle so that remove() never allocates
+			handle = static_cast<size_type>(m_handles.size());
+			if (m_handles.size() == m_handles.capacity())
+			{
+				m_handles.reserve(std::max<std::size_t>(2 * m_handles.capacity(), m_handles.size() + 1));
+			}
+			m_free.reserve(m_handles.capacity());
+			m_dense.push_back(Entry{ slot, t_ptr, handle, trackable, false });
+			m_handles.push_back(HandleEntry{ null_index, 0 });
+		}
+
+		m_handles[handle].m_dense = static_cast<size_type>(m_dense.size() - 1);
+		return Handle{ handle, m_handles[handle].m_generation };
+	}
+
+	// Disconnect the first connection of the slot
+	bool disconnect(const SlotFunctor & slot) noexcept
+	{
+		for (size_type position = 0; position < m_dense.size(); ++position)
+		{
+			if (!m_dense[position].m_removed && m_dense[position].m_slot == slot)
+			{
+				remove(position);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Check whether slot is connected to the Signal
+	bool connected(const SlotFunctor & slot) const noexcept
+	{
+		for (const Entry & entry : m_dense)
+		{
+			if (!entry.m_removed && entry.m_slot == slot)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Activate Signal. Slots connected during the emission are not reached.
+	// May throw exception if some slot does
+	void activate(ArgTs ... args)
+	{
+		if (m_blocked)
+		{
+			return;
+		}
+
+		const EmitGuard guard(*this);
+		const std::size_t count = m_dense.size();
+		for (std::size_t position = 0; position < count; ++position)
+		{
+			if (m_dense[position].m_removed)
+			{
+				continue;
+			}
+			if (!m_dense[position].m_trackable)
+			{
+				m_dense[position].m_slot(args...);
+			}
+			else if (auto ptr = m_dense[position].m_track_ptr.lock())
+			{
+				m_dense[position].m_slot(args...);
+			}
+			else
+			{
+				remove(static_cast<size_type>(position));
+			}
+		}
+	}
+
+public:
+
+	// Construct DenseSignal with room for the provided / default number of connections
+	// May throw exception if memory allocation fails
+	explicit DenseSignal(size_type capacity = 5)
+		: m_dense(),
+		m_handles(),
+		m_free(),
+		m_removed(0),
+		m_emitting(0),
+		m_blocked(false)
+	{
+		m_dense.reserve(capacity);
+		m_handles.reserve(capacity);
+		m_free.reserve(capacity);
+	}
+
+	// Deleted copy-constructor
+	DenseSignal(const DenseSignal &) = delete;
+
+	// Move-construct DenseSignal. Takes over the slots of other,
+	// other stays usable (empty). Must not be called from a slot of other.
+	DenseSignal(DenseSignal && other) noexcept
+		: m_dense(std::move(other.m_dense)),
+		m_handles(std::move(other.m_handles)),
+		m_free(std::move(other.m_free)),
+		m_removed(std::exchange(other.m_removed, 0)),
+		m_emitting(0),
+		m_blocked(other.m_blocked)
+	{
+		other.m_dense.clear();
+		other.m_handles.clear();
+		other.m_free.clear();
+	}
+
+	// Deleted copy-assignment operator
+	DenseSignal & operator=(const DenseSignal &) = delete;
+
+	// Move-assign DenseSignal. Disconnects the own slots and takes over the
+	// slots of other. Must not be called from a slot.
+	DenseSignal & operator=(DenseSignal && other) noexcept
+	{
+		if (this != &other)
+		{
+			m_dense = std::move(other.m_dense);
+			m_handles = std::move(other.m_handles);
+			m_free = std::move(other.m_free);
+			m_removed = std::exchange(other.m_removed, 0);
+			m_blocked = other.m_blocked;
+			other.m_dense.clear();
+			other.m_handles.clear();
+			other.m_free.clear();
+		}
+		return *this;
+	}
+
+	// Connect Signal to slot (function)
+	// May throw exception if memory allocation fails
+	Handle connect(ResT(*function)(ArgTs...))
+	{
+		return connect(SlotFunctor(function), TrackPtr(), false);
+	}
+
+	// Connect Signal to slot (method)
+	// May throw exception if memory allocation fails
+	template<typename Class, typename Signature>
+	Handle connect(Class * object, Signature method)
+	{
+		return connect(SlotFunctor(object, method), TrackPtr(), false);
+	}
+
+	// Connect Signal to trackable slot (method)
+	// May throw exception if memory allocation fails
+	template<typename Class, typename Signature>
+	Handle connect(std::shared_ptr<Class> object, Signature method)
+	{
+		return connect(SlotFunctor(object.get(), method), TrackPtr(object), true);
+	}
+
+	// Connect Signal to slot (functor)
+	// May throw exception if memory allocation fails
+	template<typename Class>
+	Handle connect(Class * functor)
+	{
+		return connect(SlotFunctor(functor), TrackPtr(), false);
+	}
+
+	// Connect Signal to trackable slot (functor)
+	// May throw exception if memory allocation fails
+	template<typename Class>
+	Handle connect(std::shared_ptr<Class> functor)
+	{
+		return connect(SlotFunctor(functor.get()), TrackPtr(functor), true);
+	}
+
+	// Disconnect the connection of the handle, O(1). False if it is gone already.
+	bool disconnect(Handle handle) noexcept
+	{
+		if (!handle || handle.m_index >= m_handles.size()
+			|| m_handles[handle.m_index].m_generation != handle.m_generation
+			|| m_handles[handle.m_index].m_dense == null_index)
+		{
+			return false;
+		}
+		remove(m_handles[handle.m_index].m_dense);
+		return true;
+	}
+
+	// Disconnect Signal from slot (function)
+	bool disconnect(ResT(*function)(ArgTs...)) noexcept
+	{
+		return disconnect(SlotFunctor(function));
+	}
+
+	// Disconnect Signal from slot (method)
+	template<typename Class, typename Signature>
+	bool disconnect(Class * object, Signature method) noexcept
+	{
+		return disconnect(SlotFunctor(object, method));
+	}
+
+	// Disconnect Signal from trackable slot (method)
+	template<typename Class, typename Signature>
+	bool disconnect(std::shared_ptr<Class> object, Signature method) noexcept
+	{
+		return disconnect(SlotFunctor(object.get(), method));
+	}
+
+	// Disconnect Signal from slot (functor)
+	template<typename Class>
+	bool disconnect(Class * functor) noexcept
+	{
+		return disconnect(SlotFunctor(functor));
+	}
+
+	// Disconnect Signal from trackable slot (functor)
+	template<typename Class>
+	bool disconnect(std::shared_ptr<Class> functor) noexcept
+	{
+		return disconnect(SlotFunctor(functor.get()));
+	}
+
+	// Disconnect Signal from all slots
+	void disconnect_all() noexcept
+	{
+		for (size_type position = static_cast<size_type>(m_dense.size()); position > 0; --position)
+		{
+			remove(position - 1);
+		}
+	}
+
+	// Check whether the connection of the handle is still there
+	bool connected(Handle handle) const noexcept
+	{
+		return handle && handle.m_index < m_handles.size()
+			&& m_handles[handle.m_index].m_generation == handle.m_generation
+			&& m_handles[handle.m_index].m_dense != null_index;
+	}
+
+	// Check whether slot is connected (function)
+	bool connected(ResT(*function)(ArgTs...)) const noexcept
+	{
+		return connected(SlotFunctor(function));
+	}
+
+	// Check whether slot is connected (method)
+	template<typename Class, typename Signature>
+	bool connected(Class * object, Signature method) const noexcept
+	{
+		return connected(SlotFunctor(object, method));
+	}
+
+	// Check whether slot is connected (functor)
+	template<typename Class>
+	bool connected(Class * functor) const noexcept
+	{
+		return connected(SlotFunctor(functor));
+	}
+
+	// Block Signal
+	void block(bool block = true) noexcept
+	{
+		m_blocked = block;
+	}
+
+	// Check whether Signal is blocked
+	bool blocked() const noexcept
+	{
+		return m_blocked;
+	}
+
+	// Emit Signal
+	void emit(ArgTs ... args)
+	{
+		activate(args...);
+	}
+
+	// Emit Signal
+	void operator()(ArgTs ... args)
+	{
+		activate(args...);
+	}
+
+	// Get number of connected slots
+	size_type size() const noexcept
+	{
+		return static_cast<size_type>(m_dense.size() - m_removed);
+	}
+
+	// Check whether list of connected slots is empty
+	bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+private:
+
+	std::vector<Entry>			m_dense;
+	std::vector<HandleEntry>	m_handles;
+	std::vector<size_type>		m_free;
+	size_type		m_removed;
+	unsigned		m_emitting;
+	bool			m_blocked;
 
 };
 
@@ -13,14 +13,26 @@
 
  // C++ headers
 #include <cstddef>		// std::size_t, std::nullptr_t
-#include <utility>		// std::forward<>()
+#include <cstdint>		// std::uint32_t
+#include <utility>		// std::forward<>(), std::as_const()
 #include <new>			// new()
 #include <memory>		// std::shared_ptr<>, std::weak_ptr<>
+#include <type_traits>	// std::is_same_v<>, std::is_convertible_v<>
+#include <thread>		// std::this_thread::yield()
+#include <unordered_set>	// std::unordered_set<>
+#include <chrono>		// std::chrono::steady_clock
+#include <optional>		// std::optional<>
+#include <tuple>		// std::tuple<>, std::apply()
 
 // own JeJo-lib headers
 #include "SlotT.hpp"
 #include "StorageT.hpp"
 #include "LockClassesT.hpp"
+#include "MemoryRegistryT.hpp"
+#include "TrackableT.hpp"
+#include "EmissionTraceT.hpp"
+#include "SlotTraceT.hpp"
+#include "SignalReplicaT.hpp"
 
 
 // macros for name-spacing
@@ -31,18 +43,40 @@ JEJO_BEGIN
 
 using namespace internal;
 
+// Counters of the time-budgeted emissions of a Signal
+struct EmissionBudgetStats final
+{
+	std::size_t mEmissions{ 0u };	// emit_within() calls
+	std::size_t mOverruns{ 0u };	// emit_within() / resume() calls stopped by the budget
+	std::size_t mResumes{ 0u };		// resume() calls with slots left to deliver
+	std::size_t mDropped{ 0u };		// stopped emissions never resumed (a new emit_within() came first)
+};
+
 // TEMPLATE CLASS Signal
 template<typename ReType, typename... Args> class Signal;
 
 template<typename ReType, typename... Args> class Signal<ReType(Args...)> final
 {
 private:
-	using Connection = Connection<ReType(Args...)>;
+	using Connection = internal::Connection<ReType(Args...)>;
+	using TrackableConnection = internal::TrackableConnection<ReType(Args...)>;
+	using TrackedConnection = internal::TrackedConnection<ReType(Args...)>;
 	using ConnectionPtr = Connection*;
 	using AtomicConnectionPtr = std::atomic<ConnectionPtr>;
+	using Clock = std::chrono::steady_clock;
+
+	// Stopped time-budgeted emission: its arguments and its position
+	struct BudgetState final
+	{
+		EmissionBudgetStats mStats{};
+		std::optional<std::tuple<std::decay_t<Args>...>> mArgs{};
+		std::optional<Slot<ReType(Args...)>> mLast{};	// last slot called
+		std::optional<Slot<ReType(Args...)>> mNext{};	// first slot not called
+		size_type mDelivered{ 0u };		// nodes passed before stopping
+	};
 
-	Storage<ReType(Args...)>	m_Storage;
 	AtomicConnectionPtr mp_first_slot;
+	Storage<ReType(Args...)>	m_Storage;
 	ConnectionPtr mp_deleted_s1;
 	ConnectionPtr mp_deleted_s2;
 	mutable CounterType	m_access_s1;
@@ -50,8 +84,45 @@ private:
 	mutable SlimLock		m_write_lock;
 	AccessStage			m_SyncStage;
 	AtomicBoolType				m_blocked;
+	AtomicBoolType				m_realtime;
+	std::atomic<size_type>		m_fired;	// one-shot slots called since the last reap()
+	AtomicBoolType				m_replicated;
+	const std::uint64_t			m_id;		// never reused, keys the thread-local replicas
+	std::atomic<std::uint64_t>	m_version;	// slot changes, for the replicas
+	std::atomic<EmissionTrace*>	mp_trace;
+	std::atomic<std::uint32_t>	m_trace_id;
+	RegistryHook		m_registry_hook;
+	std::unique_ptr<BudgetState>	mp_budget;	// allocated by the first emit_within()
 
 private:
+	// Memory statistics of a Signal, for the MemoryRegistry
+	static SignalMemoryStats registry_stats(const void* signal) noexcept
+	{
+		return static_cast<const Signal*>(signal)->memory_stats();
+	}
+
+	// Count nodes of a list linked by the member
+	template<typename LinkType>
+	static size_type count_nodes(ConnectionPtr current, LinkType Connection::* link) noexcept
+	{
+		size_type count = 0;
+
+		while (current)
+		{
+			++count;
+			if constexpr (std::is_same_v<LinkType, AtomicConnectionPtr>)
+			{
+				current = (current->*link).load();
+			}
+			else
+			{
+				current = current->*link;
+			}
+		}
+
+		return count;
+	}
+
 	// Access Signal's internal structure for reading
 	ReadGuard read_access() const noexcept
 	{
@@ -65,6 +136,103 @@ private:
 		return AutoLock(m_write_lock);
 	}
 
+	// Let the replicas know the slots changed.
+	// Must be called under write_access() protection.
+	void changed() noexcept
+	{
+		m_version.fetch_add(1u, std::memory_order_release);
+	}
+
+	// Destroy a node and give its memory back to the Storage
+	void destroy(Connection * node) noexcept
+	{
+		if (node->mTrackable)
+		{
+			TrackableConnection* trackable = static_cast<TrackableConnection*>(node);
+			trackable->~TrackableConnection();
+			m_Storage.deallocate(trackable);
+		}
+		else if (node->mTracked)
+		{
+			TrackedConnection* tracked = static_cast<TrackedConnection*>(node);
+			tracked->~TrackedConnection();
+			m_Storage.deallocate(tracked);
+		}
+		else
+		{
+			node->~Connection();
+			m_Storage.deallocate(node);
+		}
+	}
+
+	// Check whether the element is dead: a trackable one whose object is gone,
+	// or a one-shot one called already
+	static bool expired(const Connection & node) noexcept
+	{
+		return (node.mTrackable && static_cast<const TrackableConnection&>(node).mTrackPtr.expired())
+			|| (node.mOnce && node.mFired.load(std::memory_order_relaxed));
+	}
+
+	// Claim the call of a one-shot element: true for the first emission only
+	bool fire(Connection & node) noexcept
+	{
+		bool fired = false;
+		if (node.mFired.load(std::memory_order_relaxed)
+			|| !node.mFired.compare_exchange_strong(fired, true, std::memory_order_acq_rel))
+		{
+			return false;
+		}
+		m_fired.fetch_add(1u, std::memory_order_relaxed);
+		return true;
+	}
+
+	// Unlink the called one-shot elements, as one batch, if there are some.
+	// Must be called under write_access() protection.
+	void reap() noexcept
+	{
+		if (m_fired.load(std::memory_order_relaxed) && m_fired.exchange(0u, std::memory_order_relaxed))
+		{
+			remove_if([](const Connection& node) { return node.mOnce && node.mFired.load(std::memory_order_relaxed); });
+		}
+	}
+
+	// Let a tracked element know the link pointing to it.
+	// Must be called under write_access() protection.
+	static void relink(Connection * node, AtomicConnectionPtr * link) noexcept
+	{
+		if (node && node->mTracked)
+		{
+			static_cast<TrackedConnection*>(node)->mPrevPtr = link;
+		}
+	}
+
+	// Detach a tracked element, being removed, from its Trackable.
+	// Must be called under write_access() protection.
+	static void untrack(Connection * node) noexcept
+	{
+		if (node->mTracked)
+		{
+			TrackAccess::detach(*static_cast<TrackedConnection*>(node));
+		}
+	}
+
+	// Let the tracked elements know the Signal, after a move.
+	// Must be called under write_access() protection.
+	void retrack() noexcept
+	{
+		relink(mp_first_slot.load(), &mp_first_slot);
+		for (ConnectionPtr current = mp_first_slot.load(); current; current = current->mNextPtr.load())
+		{
+			if (current->mTracked)
+			{
+				TrackedConnection* tracked = static_cast<TrackedConnection*>(current);
+				TrackAccess::lock(*tracked);
+				tracked->mSignal = this;
+				TrackAccess::unlock(*tracked);
+			}
+		}
+	}
+
 	// Synchronize internal Signal's state - delete logically removed
 	// elements according to synchronized stage (if possible).
 	// Must be called under write_access() protection.
@@ -106,8 +274,7 @@ private:
 		while (to_delete)
 		{
 			(*first) = to_delete->mDeletedPtr;
-			to_delete->~Connection();
-			m_Storage.deallocate(to_delete);
+			destroy(to_delete);
 			to_delete = (*first);
 		}
 
@@ -147,6 +314,7 @@ private:
 			break;
 		}
 
+		node->mRemoved = true;
 		fix_pointers(node, mp_deleted_s1);
 		fix_pointers(node, mp_deleted_s2);
 
@@ -169,6 +337,8 @@ private:
 		{
 			while (to_delete)
 			{
+				untrack(to_delete);
+				to_delete->mRemoved = true;
 				to_delete->mDeletedPtr = to_delete->mNextPtr.load();
 				to_delete->mNextPtr.store(nullptr);
 				to_delete = to_delete->mDeletedPtr;
@@ -176,9 +346,92 @@ private:
 
 			remove(mp_first_slot.load());
 			mp_first_slot.store(nullptr);
+			changed();
+		}
+	}
+
+	// Let the removed elements point past the logically removed ones
+	// (a batch just unlinked), like fix_pointers() does for one element.
+	// Must be called under write_access() protection.
+	void skip_removed(Connection * removed) noexcept
+	{
+		while (removed)
+		{
+			ConnectionPtr next = removed->mNextPtr.load();
+			while (next && next->mRemoved)
+			{
+				next = next->mNextPtr.load();
+			}
+			removed->mNextPtr.store(next);
+			removed = removed->mDeletedPtr;
 		}
 	}
 
+	// Logically remove the elements matching the predicate, with one pass over
+	// the Connection list and one pass over the removed ones (not one per element).
+	// Must be called under write_access() protection.
+	template<typename Predicate>
+	size_type remove_if(Predicate&& pred) noexcept
+	{
+		synchronize();
+
+		ConnectionPtr batch = nullptr;
+		ConnectionPtr* batch_last = &batch;
+		ConnectionPtr run = nullptr; // removed since the last element kept
+		size_type count = 0;
+
+		AtomicConnectionPtr* previous = &mp_first_slot;
+		ConnectionPtr current = previous->load();
+
+		while (current)
+		{
+			ConnectionPtr next = current->mNextPtr.load();
+			if (pred(std::as_const(*current)))
+			{
+				previous->store(next);
+				untrack(current);
+				current->mRemoved = true;
+				(*batch_last) = current;
+				batch_last = &current->mDeletedPtr;
+				run = run ? run : current;
+				++count;
+			}
+			else
+			{
+				// the removed run points past itself, to this element
+				for (; run; run = run->mDeletedPtr)
+				{
+					run->mNextPtr.store(current);
+				}
+				relink(current, previous);
+				previous = &current->mNextPtr;
+			}
+			current = next;
+		}
+
+		for (; run; run = run->mDeletedPtr)
+		{
+			run->mNextPtr.store(nullptr);
+		}
+
+		if (batch)
+		{
+			changed();
+			// removed elements pointing into the batch now need one hop each
+			skip_removed(mp_deleted_s1);
+			skip_removed(mp_deleted_s2);
+
+			ConnectionPtr* last = m_SyncStage.load() == SyncStage::SyncStage_1 ? &mp_deleted_s1 : &mp_deleted_s2;
+			while (*last)
+			{
+				last = &(*last)->mDeletedPtr;
+			}
+			(*last) = batch;
+		}
+
+		return count;
+	}
+
 	// Delete logically removed elements regardless of synchronization.
 	// Must be called under write_access() protection.
 	void clear(Connection * removed) noexcept
@@ -187,20 +440,28 @@ private:
 		{
 			ConnectionPtr to_delete = removed;
 			removed = removed->mDeletedPtr;
-			to_delete->~Connection();
-			m_Storage.deallocate(to_delete);
+			destroy(to_delete);
 		}
 	}
 
-	// Connect new slot to the Signal
-	// May throw exception if memory allocation fails
+	// Unlink the element after the link and logically remove it
 	// Must be called under write_access() protection
-	bool connect(const Slot<ReType(Args...)> & slot,
-		const TrackPtr & t_ptr,
-		bool trackable)
+	void unlink(AtomicConnectionPtr * previous, Connection * node) noexcept
 	{
-		synchronize();
+		const ConnectionPtr next = node->mNextPtr.load();
+		previous->store(next);
+		relink(next, previous);
+		untrack(node);
+		remove(node);
+		changed();
+	}
 
+	// Find the link after the last element, nullptr if slot is connected already.
+	// An expired trackable element of the slot (a new object at the address of a
+	// gone one) is removed instead.
+	// Must be called under write_access() protection
+	AtomicConnectionPtr* append_link(const Slot<ReType(Args...)> & slot) noexcept
+	{
 		ConnectionPtr current = mp_first_slot.load();
 		AtomicConnectionPtr* previous = &mp_first_slot;
 
@@ -208,7 +469,13 @@ private:
 		{
 			if (current->mSlot == slot)
 			{
-				return false;
+				if (!expired(*current))
+				{
+					return nullptr;
+				}
+				const ConnectionPtr next = current->mNextPtr.load();
+				unlink(previous, current);
+				current = next;
 			}
 			else
 			{
@@ -217,17 +484,126 @@ private:
 			}
 		}
 
-		ConnectionPtr new_Connection = m_Storage.allocate();
-		::new(new_Connection) Connection(slot, t_ptr, trackable);
+		return previous;
+	}
+
+	// Connect new slot (one-shot: once) to the Signal
+	// May throw exception if memory allocation fails
+	// Must be called under write_access() protection
+	bool connect(const Slot<ReType(Args...)> & slot,
+		const TrackPtr & t_ptr,
+		bool trackable,
+		bool once = false)
+	{
+		synchronize();
+		reap();
+
+		AtomicConnectionPtr* const previous = append_link(slot);
+		if (!previous)
+		{
+			return false;
+		}
+
+		ConnectionPtr new_Connection = trackable
+			? ::new(m_Storage.template allocate<TrackableConnection>()) TrackableConnection(slot, t_ptr)
+			: ::new(m_Storage.allocate()) Connection(slot);
+		new_Connection->mOnce = once;
 		previous->store(new_Connection);
+		changed();
 		return true;
 	}
 
+	// Connect new slot (one-shot: once) of a Trackable object to the Signal
+	// May throw exception if memory allocation fails
+	// Must be called under write_access() protection
+	bool connect(const Slot<ReType(Args...)> & slot, const Trackable & owner, bool once = false)
+	{
+		synchronize();
+		reap();
+
+		AtomicConnectionPtr* const previous = append_link(slot);
+		if (!previous)
+		{
+			return false;
+		}
+
+		TrackedConnection* new_Connection = ::new(m_Storage.template allocate<TrackedConnection>())
+			TrackedConnection(slot, previous, this, &Signal::disconnect_hook);
+		new_Connection->mOnce = once;
+		TrackAccess::attach(owner, *new_Connection);
+		previous->store(new_Connection);
+		changed();
+		return true;
+	}
+
+	// Disconnect the tracked element of a Trackable being destroyed, under the lock
+	// of the Trackable: O(1), through its link. Fails if the write lock is taken,
+	// as the writers lock the Trackable while holding it.
+	static bool disconnect_hook(TrackHook & hook) noexcept
+	{
+		TrackedConnection& node = static_cast<TrackedConnection&>(hook);
+		Signal& signal = *static_cast<Signal*>(node.mSignal);
+		if (!signal.m_write_lock.try_lock())
+		{
+			return false;
+		}
+
+		signal.synchronize();
+		const ConnectionPtr next = node.mNextPtr.load();
+		node.mPrevPtr->store(next);
+		relink(next, node.mPrevPtr);
+		TrackAccess::detach_unlocked(hook);
+		signal.remove(&node);
+		signal.changed();
+
+		signal.m_write_lock.unlock();
+		return true;
+	}
+
+	// Connect new slots to the Signal, skipping the connected ones and duplicates.
+	// One pass over the Connection list (hashed slot identities), then O(1) per slot.
+	// May throw exception if memory allocation fails
+	// Must be called under write_access() protection
+	template<typename Range>
+	size_type connect_range(const Range& slots)
+	{
+		synchronize();
+		reap();
+
+		std::unordered_set<Slot<ReType(Args...)>> known;
+		AtomicConnectionPtr* last = &mp_first_slot;
+
+		for (ConnectionPtr current = last->load(); current; current = current->mNextPtr.load())
+		{
+			known.insert(current->mSlot);
+			last = &current->mNextPtr;
+		}
+
+		size_type count = 0;
+		for (const Slot<ReType(Args...)>& slot : slots)
+		{
+			if (known.insert(slot).second)
+			{
+				ConnectionPtr new_Connection = ::new(m_Storage.allocate()) Connection(slot);
+				last->store(new_Connection);
+				last = &new_Connection->mNextPtr;
+				++count;
+			}
+		}
+		if (count)
+		{
+			changed();
+		}
+
+		return count;
+	}
+
 	// Disconnect slot from the Signal
 	// Must be called under write_access() protection
 	bool disconnect(const Slot<ReType(Args...)> & slot) noexcept
 	{
 		synchronize();
+		reap();
 
 		ConnectionPtr current = mp_first_slot.load();
 		AtomicConnectionPtr* previous = &mp_first_slot;
@@ -236,8 +612,7 @@ private:
 		{
 			if (current->mSlot == slot)
 			{
-				previous->store(current->mNextPtr.load());
-				remove(current);
+				unlink(previous, current);
 				return true;
 			}
 			else
@@ -250,6 +625,30 @@ private:
 		return false;
 	}
 
+	// Disconnect the element, if still connected (not by slot: another element
+	// may have the same slot meanwhile)
+	// Must be called under write_access() protection
+	bool disconnect(Connection * node) noexcept
+	{
+		synchronize();
+
+		ConnectionPtr current = mp_first_slot.load();
+		AtomicConnectionPtr* previous = &mp_first_slot;
+
+		while (current)
+		{
+			if (current == node)
+			{
+				unlink(previous, current);
+				return true;
+			}
+			previous = &current->mNextPtr;
+			current = current->mNextPtr.load();
+		}
+
+		return false;
+	}
+
 	// Check whether slot is connected to the Signal
 	// Must be called under read_access() protection
 	bool connected(const Slot<ReType(Args...)> & slot) const noexcept
@@ -258,7 +657,7 @@ private:
 
 		while (current)
 		{
-			if (current->mSlot == slot)
+			if (current->mSlot == slot && !expired(*current))
 			{
 				return true;
 			}
@@ -271,10 +670,86 @@ private:
 		return false;
 	}
 
-	// Activate Signal
+	// Detach the connected slots, e.g. for a move: wait until the emissions
+	// in flight have finished and reclaim all the logically removed elements.
+	// Emissions starting afterwards see an empty Signal.
+	// Must be called under write_access() protection.
+	ConnectionPtr quiesce() noexcept
+	{
+		ConnectionPtr first = mp_first_slot.exchange(nullptr);
+		changed();
+
+		// emissions which might still see the detached slots were counted before the exchange
+		while (m_access_s1.load())
+		{
+			std::this_thread::yield();
+		}
+		while (m_access_s2.load())
+		{
+			std::this_thread::yield();
+		}
+
+		clear(std::exchange(mp_deleted_s1, nullptr));
+		clear(std::exchange(mp_deleted_s2, nullptr));
+		return first;
+	}
+
+	// Delete all elements of a detached Connection list.
+	// Must be called under write_access() protection.
+	void clear_detached(ConnectionPtr current) noexcept
+	{
+		while (current)
+		{
+			ConnectionPtr to_delete = current;
+			current = current->mNextPtr.load();
+			untrack(to_delete);
+			destroy(to_delete);
+		}
+	}
+
+	// Move-construct Signal, under write_access() protection of other
+	Signal(Signal&& other, const AutoLock&) noexcept
+		: mp_first_slot{ other.quiesce() }
+		, m_Storage{ std::move(other.m_Storage) }
+		, mp_deleted_s1{ nullptr }
+		, mp_deleted_s2{ nullptr }
+		, m_access_s1{ 0 }
+		, m_access_s2{ 0 }
+		, m_write_lock{}
+		, m_SyncStage{ SyncStage::SyncStage_1 }
+		, m_blocked{ other.m_blocked.load() }
+		, m_realtime{ other.m_realtime.load() }
+		, m_fired{ other.m_fired.exchange(0u) }
+		, m_replicated{ other.m_replicated.load() }
+		, m_id{ signal_serial.fetch_add(1u, std::memory_order_relaxed) + 1u }
+		, m_version{ 0u }
+		, mp_trace{ other.mp_trace.load() }
+		, m_trace_id{ other.m_trace_id.load() }
+		, m_registry_hook{ this, &Signal::registry_stats }
+		, mp_budget{ std::move(other.mp_budget) }
+	{
+		const auto writer{ write_access() }; // no Trackable reaches this Signal before retrack()
+		retrack();
+	}
+
+	// Append the emission to the trace, if recording
+	void trace(const Args& ... args) noexcept
+	{
+#if JEJO_HAS_MMAP
+		if constexpr ((std::is_trivially_copyable_v<std::decay_t<Args>> && ...))
+		{
+			if (EmissionTrace* const trace = mp_trace.load(std::memory_order_acquire))
+			{
+				trace->append(m_trace_id.load(std::memory_order_relaxed), static_cast<const std::decay_t<Args>&>(args)...);
+			}
+		}
+#endif
+	}
+
+	// Activate Signal. Every slot gets the same (lvalue) arguments.
 	// May throw exception if some slot does
 	// Must be called under read_access() protection
-	void activate(Args&& ... args)
+	void activate(Args& ... args)
 	{
 		ConnectionPtr current = mp_first_slot.load();
 
@@ -282,36 +757,215 @@ private:
 		{
 			if (!current->mTrackable)
 			{
-				current->mSlot(std::forward<Args>(args)...);
+				if (!current->mOnce || fire(*current))
+				{
+#ifdef JEJO_SIGNAL_TRACING
+					const internal::SlotSpan span{ current->mSlot, this, m_realtime.load(std::memory_order_relaxed) };
+#endif
+					current->mSlot(args...);
+				}
 				current = current->mNextPtr.load();
 			}
 			else
 			{
-				auto ptr = current->mTrackPtr.lock();
+				auto ptr = static_cast<TrackableConnection*>(current)->mTrackPtr.lock();
 
 				if (ptr)
 				{
-					current->mSlot(std::forward<Args>(args)...);
+					if (!current->mOnce || fire(*current))
+					{
+#ifdef JEJO_SIGNAL_TRACING
+						const internal::SlotSpan span{ current->mSlot, this, m_realtime.load(std::memory_order_relaxed) };
+#endif
+						current->mSlot(args...);
+					}
 					current = current->mNextPtr.load();
 				}
 				else
 				{
+					// remove the expired slot, unless a writer holds the lock (then
+					// a later emission does): an emission never waits for writers.
+					// In real-time mode skip it, collect() removes it.
 					ConnectionPtr to_delete = current;
 					current = current->mNextPtr.load();
-					auto writer = write_access();
-					disconnect(to_delete->mSlot);
+					if (!m_realtime.load(std::memory_order_relaxed) && m_write_lock.try_lock())
+					{
+						disconnect(to_delete);
+						m_write_lock.unlock();
+					}
 				}
 			}
 		}
 	}
 
+	// Call the slot of the node, unless it is dead (expired object, one-shot called)
+	// May throw exception if the slot does
+	void call(ConnectionPtr node, Args& ... args)
+	{
+		if (node->mTrackable)
+		{
+			auto ptr = static_cast<TrackableConnection*>(node)->mTrackPtr.lock();
+			if (!ptr || (node->mOnce && !fire(*node)))
+			{
+				return; // a writer / collect() removes it
+			}
+#ifdef JEJO_SIGNAL_TRACING
+			const internal::SlotSpan span{ node->mSlot, this, m_realtime.load(std::memory_order_relaxed) };
+#endif
+			node->mSlot(args...);
+		}
+		else if (!node->mOnce || fire(*node))
+		{
+#ifdef JEJO_SIGNAL_TRACING
+			const internal::SlotSpan span{ node->mSlot, this, m_realtime.load(std::memory_order_relaxed) };
+#endif
+			node->mSlot(args...);
+		}
+	}
+
+	// Activate Signal from the node on, until the deadline has passed (checked
+	// after each slot, at least one slot gets called). delivered: nodes passed
+	// before the node. Returns true if the end was reached, else the stopped
+	// emission is kept for resume().
+	// May throw exception if some slot does
+	// Must be called under read_access() protection
+	bool activate_within(ConnectionPtr current, size_type delivered, Clock::time_point deadline, Args& ... args)
+	{
+		while (current)
+		{
+			const ConnectionPtr node = current;
+			call(node, args...);
+			current = node->mNextPtr.load();
+			++delivered;
+
+			if (current && Clock::now() >= deadline)
+			{
+				mp_budget->mArgs.emplace(args...);
+				mp_budget->mLast.emplace(node->mSlot);
+				mp_budget->mNext.emplace(current->mSlot);
+				mp_budget->mDelivered = delivered;
+				++mp_budget->mStats.mOverruns;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Node to resume the stopped emission at: the first slot it did not reach;
+	// if that got disconnected meanwhile, the node after the last slot it
+	// reached; if both got disconnected, the node as many nodes from the front
+	// (slots disconnected before the position shift it: some slots get skipped).
+	// Must be called under read_access() protection
+	ConnectionPtr resume_position(size_type& delivered) const noexcept
+	{
+		delivered = 0u;
+		for (ConnectionPtr current = mp_first_slot.load(); current; current = current->mNextPtr.load(), ++delivered)
+		{
+			if (current->mSlot == *mp_budget->mNext)
+			{
+				return current;
+			}
+		}
+
+		delivered = 0u;
+		for (ConnectionPtr current = mp_first_slot.load(); current; current = current->mNextPtr.load())
+		{
+			++delivered;
+			if (current->mSlot == *mp_budget->mLast)
+			{
+				return current->mNextPtr.load();
+			}
+		}
+
+		ConnectionPtr current = mp_first_slot.load();
+		for (delivered = 0u; current && delivered < mp_budget->mDelivered; ++delivered)
+		{
+			current = current->mNextPtr.load();
+		}
+		return current;
+	}
+
+	// Copy the slots into the replica of the thread, at the current version.
+	// May throw exception if memory allocation fails
+	void rebuild(Replica<ReType(Args...)>& replica) const
+	{
+		auto reader = read_access();
+		replica.mSignal = 0u; // no valid copy until done
+		replica.mShared = false;
+		replica.mEntries.clear();
+		const std::uint64_t version = m_version.load(std::memory_order_acquire);
+
+		for (ConnectionPtr current = mp_first_slot.load(); current; current = current->mNextPtr.load())
+		{
+			replica.mShared = replica.mShared || current->mOnce;
+			replica.mEntries.push_back({ current->mSlot
+				, current->mTrackable ? static_cast<TrackableConnection*>(current)->mTrackPtr : TrackPtr()
+				, current->mTrackable });
+		}
+
+		replica.mVersion = version;
+		replica.mSignal = m_id;
+	}
+
+	// Check whether the emissions use the replicas: replicated, not real-time
+	// mode (copying a replica allocates)
+	bool use_replica() const noexcept
+	{
+		return m_replicated.load(std::memory_order_relaxed) && !m_realtime.load(std::memory_order_relaxed);
+	}
+
+	// Activate Signal out of the replica of the thread, copied again if the
+	// slots changed. Nested emissions of a replica in use, and Signals with
+	// one-shot slots (called once over all the threads), use the shared list.
+	// May throw exception if memory allocation / some slot does
+	void activate_replica(Args& ... args)
+	{
+		Replica<ReType(Args...)>& replica = internal::replica<ReType(Args...)>(m_id);
+		if (replica.mSignal != m_id || replica.mVersion != m_version.load(std::memory_order_relaxed))
+		{
+			if (replica.mDepth)
+			{
+				auto reader = read_access();
+				activate(args...);
+				return;
+			}
+			rebuild(replica);
+		}
+		if (replica.mShared)
+		{
+			auto reader = read_access();
+			activate(args...);
+			return;
+		}
+
+		const ReplicaUse<Replica<ReType(Args...)>> use{ replica };
+		for (const auto& entry : replica.mEntries)
+		{
+			if (!entry.mTrackable)
+			{
+#ifdef JEJO_SIGNAL_TRACING
+				const internal::SlotSpan span{ entry.mSlot, this };
+#endif
+				entry.mSlot(args...);
+			}
+			else if (auto ptr = entry.mTrackPtr.lock())
+			{
+#ifdef JEJO_SIGNAL_TRACING
+				const internal::SlotSpan span{ entry.mSlot, this };
+#endif
+				entry.mSlot(args...);
+			}
+			// expired ones are skipped, a writer / collect() removes them
+		}
+	}
+
 public:
 
 	// Construct Signal with provided / default capacity
 	// May throw exception if memory allocation fails
 	explicit Signal(size_type capacity = 5)
-		: m_Storage{ capacity }
-		, mp_first_slot{ nullptr }
+		: mp_first_slot{ nullptr }
+		, m_Storage{ capacity }
 		, mp_deleted_s1{ nullptr }
 		, mp_deleted_s2{ nullptr }
 		, m_access_s1{ 0 }
@@ -319,14 +973,64 @@ public:
 		, m_write_lock{}
 		, m_SyncStage{ SyncStage::SyncStage_1 }
 		, m_blocked{ false }
-	{}
+		, m_realtime{ false }
+		, m_fired{ 0u }
+		, m_replicated{ false }
+		, m_id{ signal_serial.fetch_add(1u, std::memory_order_relaxed) + 1u }
+		, m_version{ 0u }
+		, mp_trace{ nullptr }
+		, m_trace_id{ 0u }
+		, m_registry_hook{ this, &Signal::registry_stats }
+		, mp_budget{ nullptr }
+	{
+		MemoryRegistry::instance().attach(m_registry_hook);
+	}
+
+	// Construct Signal whose Connection nodes live in a mmap-backed arena:
+	// optionally huge-page backed and pre-faulted, heap if mmap is unavailable.
+	// May throw exception if memory allocation fails
+	Signal(size_type capacity, const ArenaConfig& arena)
+		: mp_first_slot{ nullptr }
+		, m_Storage{ capacity, arena }
+		, mp_deleted_s1{ nullptr }
+		, mp_deleted_s2{ nullptr }
+		, m_access_s1{ 0 }
+		, m_access_s2{ 0 }
+		, m_write_lock{}
+		, m_SyncStage{ SyncStage::SyncStage_1 }
+		, m_blocked{ false }
+		, m_realtime{ false }
+		, m_fired{ 0u }
+		, m_replicated{ false }
+		, m_id{ signal_serial.fetch_add(1u, std::memory_order_relaxed) + 1u }
+		, m_version{ 0u }
+		, mp_trace{ nullptr }
+		, m_trace_id{ 0u }
+		, m_registry_hook{ this, &Signal::registry_stats }
+		, mp_budget{ nullptr }
+	{
+		MemoryRegistry::instance().attach(m_registry_hook);
+	}
 
 	// Deleted copy-constructor
 	constexpr Signal(const Signal&) noexcept = delete;
 
+	// Move-construct Signal. Takes over the slots and the Storage of other;
+	// waits until the emissions of other in flight have finished. Emissions of
+	// other starting during or after the move reach no slot; other stays
+	// usable (empty). Connecting to other during the move is not allowed.
+	Signal(Signal&& other) noexcept
+		: Signal{ std::move(other), other.write_access() }
+	{
+		// after the lock of other is released: MemoryRegistry::aggregate() takes
+		// the registry lock, then the locks of the Signals
+		MemoryRegistry::instance().attach(m_registry_hook);
+	}
+
 	// Destroy Signal
 	~Signal() noexcept
 	{
+		MemoryRegistry::instance().detach(m_registry_hook);
 		const auto writer{ this->write_access() };
 		this->remove_all();
 		this->clear(mp_deleted_s1);
@@ -336,6 +1040,33 @@ public:
 	// Deleted copy-assignment operator
 	constexpr Signal& operator=(const Signal&) noexcept = delete;
 
+	// Move-assign Signal. Disconnects the own slots and takes over the slots
+	// and the Storage of other, with the same guarantees as the move-constructor.
+	Signal& operator=(Signal&& other) noexcept
+	{
+		if (this != &other)
+		{
+			// lock in address order, two moves in opposite directions must not deadlock
+			const auto first_writer{ this < &other ? write_access() : other.write_access() };
+			const auto second_writer{ this < &other ? other.write_access() : write_access() };
+
+			clear_detached(quiesce());
+			ConnectionPtr first = other.quiesce();
+			m_Storage = std::move(other.m_Storage);
+			mp_first_slot.store(first);
+			retrack();
+			m_blocked.store(other.m_blocked.load());
+			m_realtime.store(other.m_realtime.load());
+			m_fired.store(other.m_fired.exchange(0u));
+			m_replicated.store(other.m_replicated.load());
+			changed();
+			m_trace_id.store(other.m_trace_id.load());
+			mp_trace.store(other.mp_trace.load());
+			mp_budget = std::move(other.mp_budget);
+		}
+		return *this;
+	}
+
 	// Connect Signal to slot (static method / free function)
 	// May throw exception if memory allocation fails
 	bool connect(ReType(*function)(Args...))
@@ -344,13 +1075,20 @@ public:
 		return connect(Slot<ReType(Args...)>(function), TrackPtr(), false);
 	}
 
-	// Connect Signal to slot (method)
+	// Connect Signal to slot (method). The slot of a Trackable object is tracked.
 	// May throw exception if memory allocation fails
 	template<typename ClassType, typename FunctionPtrType>
 	bool connect(ClassType* object, FunctionPtrType method)
 	{
 		auto writer = write_access();
-		return connect(Slot<ReType(Args...)>(object, method), TrackPtr(), false);
+		if constexpr (std::is_convertible_v<ClassType*, const Trackable*>)
+		{
+			return connect(Slot<ReType(Args...)>(object, method), static_cast<const Trackable&>(*object));
+		}
+		else
+		{
+			return connect(Slot<ReType(Args...)>(object, method), TrackPtr(), false);
+		}
 	}
 
 	// Connect Signal to traceable slot (method)
@@ -362,13 +1100,20 @@ public:
 		return connect(Slot<ReType(Args...)>(object.get(), method), TrackPtr(object), true);
 	}
 
-	// Connect Signal to slot (functor)
+	// Connect Signal to slot (functor). The slot of a Trackable functor is tracked.
 	// May throw exception if memory allocation fails
 	template<typename ClassType>
 	bool connect(ClassType* functor)
 	{
 		auto writer = write_access();
-		return connect(Slot<ReType(Args...)>(functor), TrackPtr(), false);
+		if constexpr (std::is_convertible_v<ClassType*, const Trackable*>)
+		{
+			return connect(Slot<ReType(Args...)>(functor), static_cast<const Trackable&>(*functor));
+		}
+		else
+		{
+			return connect(Slot<ReType(Args...)>(functor), TrackPtr(), false);
+		}
 	}
 
 	// Connect Signal to traceable slot (functor)
@@ -380,6 +1125,67 @@ public:
 		return connect(Slot<ReType(Args...)>(functor.get()), TrackPtr(functor), true);
 	}
 
+	// Connect Signal to one-shot slot (static method / free function): the first
+	// emission reaching it calls it, then it is dead (one CAS, no lock during the
+	// emission); the next connect() / disconnect() / collect() unlinks the dead
+	// ones as one batch. The same slot may get connected again afterwards.
+	// May throw exception if memory allocation fails
+	bool connect_once(ReType(*function)(Args...))
+	{
+		const auto writer{ write_access() };
+		return connect(Slot<ReType(Args...)>(function), TrackPtr(), false, true);
+	}
+
+	// Connect Signal to one-shot slot (method). The slot of a Trackable object is tracked.
+	// May throw exception if memory allocation fails
+	template<typename ClassType, typename FunctionPtrType>
+	bool connect_once(ClassType* object, FunctionPtrType method)
+	{
+		auto writer = write_access();
+		if constexpr (std::is_convertible_v<ClassType*, const Trackable*>)
+		{
+			return connect(Slot<ReType(Args...)>(object, method), static_cast<const Trackable&>(*object), true);
+		}
+		else
+		{
+			return connect(Slot<ReType(Args...)>(object, method), TrackPtr(), false, true);
+		}
+	}
+
+	// Connect Signal to traceable one-shot slot (method)
+	// May throw exception if memory allocation fails
+	template<typename ClassType, typename FunctionPtrType>
+	bool connect_once(std::shared_ptr<ClassType> object, FunctionPtrType method)
+	{
+		auto writer = write_access();
+		return connect(Slot<ReType(Args...)>(object.get(), method), TrackPtr(object), true, true);
+	}
+
+	// Connect Signal to one-shot slot (functor). The slot of a Trackable functor is tracked.
+	// May throw exception if memory allocation fails
+	template<typename ClassType>
+	bool connect_once(ClassType* functor)
+	{
+		auto writer = write_access();
+		if constexpr (std::is_convertible_v<ClassType*, const Trackable*>)
+		{
+			return connect(Slot<ReType(Args...)>(functor), static_cast<const Trackable&>(*functor), true);
+		}
+		else
+		{
+			return connect(Slot<ReType(Args...)>(functor), TrackPtr(), false, true);
+		}
+	}
+
+	// Connect Signal to traceable one-shot slot (functor)
+	// May throw exception if memory allocation fails
+	template<typename ClassType>
+	bool connect_once(std::shared_ptr<ClassType> functor)
+	{
+		auto writer = write_access();
+		return connect(Slot<ReType(Args...)>(functor.get()), TrackPtr(functor), true, true);
+	}
+
 	// Disconnect Signal from slot (static method / free function)
 	bool disconnect(ReType(*function)(Args...)) noexcept
 	{
@@ -426,6 +1232,47 @@ public:
 		remove_all();
 	}
 
+	// Remove the expired trackable slots and the called one-shot slots, and
+	// reclaim the removed nodes whose emissions have finished: the maintenance
+	// of the real-time mode.
+	// Returns the number of removed slots.
+	size_type collect() noexcept
+	{
+		auto writer = write_access();
+		m_fired.store(0u, std::memory_order_relaxed);
+		const size_type count = remove_if([](const Connection& node) { return expired(node); });
+		synchronize();
+		return count;
+	}
+
+	// Connect Signal to a range of slots (non trackable) with one lock acquisition.
+	// Returns the number of newly connected slots.
+	// May throw exception if memory allocation fails
+	template<typename Range>
+	size_type connect_all(const Range& slots)
+	{
+		auto writer = write_access();
+		return connect_range(slots);
+	}
+
+	// Disconnect Signal from all slots matching the predicate(const Slot&),
+	// with one lock acquisition and one pass. Returns the number of slots.
+	template<typename Predicate>
+	size_type disconnect_if(Predicate pred) noexcept
+	{
+		auto writer = write_access();
+		return remove_if([&pred](const Connection& node) { return pred(node.mSlot); });
+	}
+
+	// Disconnect Signal from every slot bound to the object (methods, functor)
+	template<typename ClassType>
+	size_type disconnect_instance(const ClassType* object) noexcept
+	{
+		auto writer = write_access();
+		return remove_if([object](const Connection& node) {
+			return node.mSlot.instance() == static_cast<const void*>(object); });
+	}
+
 	// Check whether slot is connected (static method / free function)
 	bool connected(ReType(*function)(Args...)) const noexcept
 	{
@@ -477,42 +1324,192 @@ public:
 		return m_blocked.load();
 	}
 
+	// Record the emissions (blocked ones included) into the trace, as signal id.
+	// nullptr stops recording; the trace must outlive the emissions in flight.
+	void record(EmissionTrace* trace, std::uint32_t id = 0u) noexcept
+	{
+		static_assert((std::is_trivially_copyable_v<std::decay_t<Args>> && ...),
+			"only Signals with trivially copyable arguments can be recorded");
+		auto writer = write_access();
+		m_trace_id.store(id, std::memory_order_relaxed);
+		mp_trace.store(trace, std::memory_order_release);
+	}
+
+	// Set real-time mode. An emission then takes no lock, allocates and frees
+	// nothing and never waits: a few atomic loads / one counter add per step
+	// over the slots (wait-free on x86-64). Expired trackable slots are skipped,
+	// not removed: call collect() from a non real-time thread.
+	// A weak_ptr-tracked slot still costs its weak_ptr::lock() (a CAS loop on
+	// the control block), and the emission destroys its object if the last
+	// owner lets go meanwhile: use plain or Trackable slots on real-time threads.
+	// Real-time mode overrides replicated mode (replicate()): the emissions use
+	// the shared list, as copying a replica allocates. Built with
+	// JEJO_SIGNAL_TRACING, the slots are only traced on threads which called
+	// SlotTrace::instance().attach_thread() (see SlotTraceT.hpp).
+	void realtime(bool realtime = true) noexcept
+	{
+		m_realtime.store(realtime);
+	}
+
+	// Check whether Signal is in real-time mode
+	bool realtime() const noexcept
+	{
+		return m_realtime.load();
+	}
+
+	// Set replicated mode, for Signals emitted very often from several cores:
+	// every emitting thread calls the slots out of its own copy of them,
+	// checked against the slot changes with one relaxed load per emission and
+	// copied again after a connect / disconnect (see SignalReplicaT.hpp). The
+	// emissions then write no shared cache line of the Signal, but a copy costs
+	// an allocation (once per thread and Signal, then on growth). Disconnecting
+	// has the usual guarantee: emissions starting after it do not reach the slot.
+	// Time-budgeted emissions, Signals with one-shot slots and Signals in
+	// real-time mode (realtime(): no allocation on the emitting thread) use the
+	// shared list.
+	void replicate(bool replicate = true) noexcept
+	{
+		m_replicated.store(replicate);
+	}
+
+	// Check whether Signal is in replicated mode
+	bool replicated() const noexcept
+	{
+		return m_replicated.load();
+	}
+
 	// Emit Signal
-	// May throw exception if some slot does
+	// May throw exception if some slot (replicated, not real-time mode: memory allocation) does
 	void emit(Args&&... args)
 	{
+		if (use_replica())
+		{
+			trace(args...);
+			if (!m_blocked.load(std::memory_order_relaxed))
+			{
+				activate_replica(args...);
+			}
+			return;
+		}
 		auto reader = read_access();
+		trace(args...);
 		if (!m_blocked.load())
 		{
-			activate(std::forward<Args>(args)...);
+			activate(args...);
 		}
 	}
 
 	// Emit Signal
-	// May throw exception if some slot does
+	// May throw exception if some slot (replicated, not real-time mode: memory allocation) does
 	void operator()(Args ... args)
 	{
+		if (use_replica())
+		{
+			trace(args...);
+			if (!m_blocked.load(std::memory_order_relaxed))
+			{
+				activate_replica(args...);
+			}
+			return;
+		}
 		auto reader = read_access();
+		trace(args...);
 		if (!m_blocked.load())
 		{
 			activate(args...);
 		}
 	}
 
+	// Emit Signal within the time budget: no further slot is called once the
+	// budget is exhausted (checked after each slot; a slot is not interrupted).
+	// Returns true if every slot got called, else resume() delivers the same
+	// arguments (copies of them) to the remaining slots. A stopped emission not
+	// resumed before the next emit_within() is dropped. The time-budgeted
+	// emissions of a Signal (and resume()) are made by one thread at a time.
+	// May throw exception if memory allocation (the first call) / some slot does
+	bool emit_within(std::chrono::nanoseconds budget, Args ... args)
+	{
+		const Clock::time_point deadline = Clock::now() + budget;
+		if (!mp_budget)
+		{
+			mp_budget = std::make_unique<BudgetState>();
+		}
+		++mp_budget->mStats.mEmissions;
+		if (mp_budget->mArgs)
+		{
+			mp_budget->mArgs.reset();
+			++mp_budget->mStats.mDropped;
+		}
+
+		auto reader = read_access();
+		trace(args...);
+		if (m_blocked.load())
+		{
+			return true;
+		}
+		return activate_within(mp_first_slot.load(), 0u, deadline, args...);
+	}
+
+	// Continue the stopped time-budgeted emission within the time budget: the
+	// slots it did not reach get its arguments, the slots connected meanwhile
+	// behind its position too. Returns true if no slot is left to call.
+	// While Signal is blocked the emission stays stopped.
+	// May throw exception if some slot does
+	bool resume(std::chrono::nanoseconds budget)
+	{
+		const Clock::time_point deadline = Clock::now() + budget;
+		if (!pending())
+		{
+			return true;
+		}
+
+		auto reader = read_access();
+		if (m_blocked.load())
+		{
+			return false;
+		}
+		++mp_budget->mStats.mResumes;
+		size_type delivered = 0u;
+		ConnectionPtr current = resume_position(delivered);
+		std::tuple<std::decay_t<Args>...> values = std::move(*mp_budget->mArgs);
+		mp_budget->mArgs.reset();
+		return std::apply([&](auto& ... args) { return activate_within(current, delivered, deadline, args...); }, values);
+	}
+
+	// Check whether a stopped time-budgeted emission waits for resume()
+	bool pending() const noexcept
+	{
+		return mp_budget && mp_budget->mArgs;
+	}
+
+	// Get the counters of the time-budgeted emissions
+	EmissionBudgetStats budget_stats() const noexcept
+	{
+		return mp_budget ? mp_budget->mStats : EmissionBudgetStats{};
+	}
+
 	// Get number of connected slots
 	size_type size() const noexcept
 	{
 		auto writer = write_access();
-		ConnectionPtr current = mp_first_slot.load();
-		size_type size = 0;
-
-		while (current)
+		size_type count = 0;
+		for (ConnectionPtr current = mp_first_slot.load(); current; current = current->mNextPtr.load())
 		{
-			++size;
-			current = current->mNextPtr.load();
+			// called one-shot slots are gone already, only not unlinked yet
+			count += !(current->mOnce && current->mFired.load(std::memory_order_relaxed));
 		}
+		return count;
+	}
 
-		return size;
+	// Get memory statistics: Storage, connected slots and
+	// logically removed nodes waiting for the deferred reclamation
+	SignalMemoryStats memory_stats() const noexcept
+	{
+		auto writer = write_access();
+		return SignalMemoryStats{ m_Storage.stats()
+			, count_nodes(mp_first_slot.load(), &Connection::mNextPtr)
+			, count_nodes(mp_deleted_s1, &Connection::mDeletedPtr)
+			, count_nodes(mp_deleted_s2, &Connection::mDeletedPtr) };
 	}
 
 	// Check whether list of connected slots is empty
@@ -15,26 +15,30 @@
  // C++ headers
 #include <cstddef>		// std::size_t, std::nullptr_t
 #include <utility>		// std::move(), std::forward<>()
-#include <algorithm>	// std::copy()
 #include <array>        // std::array<>, std::cbegin(), std::cend()
 #include <functional>   // std::invoke()
 #include <new>			// new()
 #include <atomic>		// std::atomic<>, std::atomic_flag
+#include <memory>		// std::weak_ptr<>
+#include <cstring>		// std::memcpy(), std::memcmp()
+#include <cstdint>		// std::uintptr_t, std::uint64_t
 
 // Macros for dynamic memory allocation
 #define NEW_MEMORY(arg) ::operator new(arg)
 #define DELETE_MEMORY(arg) ::operator delete(arg)
 
 // own JeJo-lib headers
+#include "TrackableT.hpp"
+
 namespace JeJo::internal
 {
 	// Synchronization stage. Specifies current access stage.
 	enum class SyncStage : char { SyncStage_1 = 1, SyncStage_2 = 2 };
 
 	using Byte = unsigned char;
+	using WordType = std::uintptr_t;
 	using size_type = std::size_t;
 	using AtomicBoolType = std::atomic<bool>;
-	using CounterType = std::atomic<unsigned short>;
 	using AccessStage = std::atomic<SyncStage>;
 	using TrackPtr = std::weak_ptr<void>;
 
@@ -61,56 +65,74 @@ namespace JeJo::internal
 		// Default TargetSlot type
 		using DefaultType = TargetSlot<DefaultClass, DefaultFunction>;
 
-		// Size of default target data
+		// Size of default target data, in bytes and in words
 		static const size_type target_size = sizeof(DefaultType);
+		static const size_type target_words = (target_size + sizeof(WordType) - 1u) / sizeof(WordType);
 
-		// Storage for target data
-		using SlotStorage = std::array<Byte, target_size>;
+		// Storage for target data (whole words, zero filled beyond the target)
+		using SlotStorage = std::array<Byte, target_words * sizeof(WordType)>;
 
 		// Type of invoker-function
-		using InvokerType = ReType(*)(const Byte* const, Args&&...);
+		using InvokerType = ReType(*)(const Byte* const, Args&...);
 
 		alignas(DefaultType)SlotStorage mTarget;
 		alignas(InvokerType)InvokerType mInvoker;
 
 		// Invoke target slot (static method / free function)
 		template<std::nullptr_t, typename FunctionPtrType>
-		static ReType invoke(const Byte* const data, Args&&... args)
+		static ReType invoke(const Byte* const data, Args&... args)
 		{
 			return std::invoke(
 				(*reinterpret_cast<const TargetSlot<std::nullptr_t, FunctionPtrType>*>(data)->mFunctionPtr)
-				, std::forward<Args>(args)...);
+				, args...);
 		}
 
 		// Invoke target slot (method)
 		template<typename ClassType, typename FunctionPtrType>
-		static ReType invoke(const Byte* const data, Args&&... args)
+		static ReType invoke(const Byte* const data, Args&... args)
 		{
 			return std::invoke(
 				reinterpret_cast<const TargetSlot<ClassType, FunctionPtrType>*>(data)->mFunctionPtr
-				, reinterpret_cast<const TargetSlot<ClassType, FunctionPtrType>*>(data)->mClassInstance					
-				, std::forward<Args>(args)...);
+				, reinterpret_cast<const TargetSlot<ClassType, FunctionPtrType>*>(data)->mClassInstance
+				, args...);
 		}
 
 		// Invoke target slot (functor)
 		template<typename ClassType, std::nullptr_t>
-		static ReType invoke(const Byte* const data, Args&&... args)
+		static ReType invoke(const Byte* const data, Args&... args)
 		{
 			return std::invoke(
-				(*reinterpret_cast<const TargetSlot<ClassType, std::nullptr_t>*>(data)->mClassInstance)
-				, std::forward<Args>(args)...);
+				(*reinterpret_cast<const TargetSlot<ClassType, const void*>*>(data)->mClassInstance)
+				, args...);
+		}
+
+		// Store the target pointers. The identity of the slot is fixed from here on:
+		// the storage was zero filled, so equal targets have equal bytes.
+		template<typename ClassType, typename FunctionPtrType>
+		void store(ClassType* instance, FunctionPtrType function) noexcept
+		{
+			static_assert(sizeof(TargetSlot<ClassType, FunctionPtrType>) <= target_size);
+			const TargetSlot<ClassType, FunctionPtrType> target{ instance, function };
+			std::memcpy(mTarget.data(), &target, sizeof(target));
 		}
 
 	public:
+		// Identity of a slot: invoker plus the target words (instance, function pointer)
+		struct Identity final
+		{
+			InvokerType mInvoker{ nullptr };
+			std::array<WordType, target_words> mWords{};
+
+			bool operator==(const Identity& other) const noexcept = default;
+		};
+
 		// Construct Slot (static method / free function)
-		Slot(ReType(*function)(Args&&...)) noexcept
+		Slot(ReType(*function)(Args...)) noexcept
 			: mTarget{}
 			, mInvoker{ nullptr }
 		{
 			using FunctionPtrType = decltype(function);
-			auto Storage = reinterpret_cast<TargetSlot<std::nullptr_t, FunctionPtrType>*>(&mTarget[0]);
-			Storage->mFunctionPtr = function;
-			Storage->mClassInstance = nullptr;
+			store<std::nullptr_t>(nullptr, function);
 			mInvoker = &Slot::invoke<nullptr, FunctionPtrType>;
 		}
 
@@ -120,9 +142,7 @@ namespace JeJo::internal
 			: mTarget{}
 			, mInvoker{ nullptr }
 		{
-			auto Storage = reinterpret_cast<TargetSlot<ClassType, FunctionPtrType>*>(&mTarget[0]);
-			Storage->mFunctionPtr = method;
-			Storage->mClassInstance = object;
+			store(object, method);
 			mInvoker = &Slot::invoke<ClassType, FunctionPtrType>;
 		}
 
@@ -132,9 +152,7 @@ namespace JeJo::internal
 			: mTarget{}
 			, mInvoker{ nullptr }
 		{
-			auto Storage = reinterpret_cast<TargetSlot<ClassType, std::nullptr_t>*>(&mTarget[0]);
-			Storage->mFunctionPtr = nullptr;
-			Storage->mClassInstance = functor;
+			store(functor, static_cast<const void*>(nullptr));
 			mInvoker = &Slot::invoke<ClassType, nullptr>;
 		}
 
@@ -142,83 +160,98 @@ namespace JeJo::internal
 		Slot(std::nullptr_t) noexcept = delete;
 
 		// Copy-construct Slot
-		Slot(const Slot& other) noexcept
-		{
-			std::copy(std::cbegin(other.mTarget), std::cend(other.mTarget), std::begin(mTarget));
-
-			mInvoker = other.mInvoker;
-		}
+		Slot(const Slot& other) noexcept = default;
 
 		// Copy-assign Slot
-		Slot& operator=(const Slot& other) noexcept
-		{
-			if (this != &other)
-			{
-				std::copy(std::cbegin(other.mTarget), std::cend(other.mTarget), std::begin(mTarget));
-
-				mInvoker = other.mInvoker;
-			}
-			return *this;
-		}
+		Slot& operator=(const Slot& other) noexcept = default;
 
 		// Destroy Slot
 		~Slot() noexcept = default;
 
 		// Invoke target slot
-		ReType operator()(Args&&... args) const
+		ReType operator()(Args&... args) const
+		{
+			return (*mInvoker)(mTarget.data(), args...);
+		}
+
+		// Identity of the slot
+		Identity identity() const noexcept
+		{
+			Identity id{ mInvoker, {} };
+			std::memcpy(id.mWords.data(), mTarget.data(), sizeof(mTarget));
+			return id;
+		}
+
+		// Object the slot is bound to (method / functor), nullptr for free functions
+		const void* instance() const noexcept
 		{
-			return  std::invoke(*mInvoker, &mTarget[0], std::forward<Args>(args)...);
+			return reinterpret_cast<const void*>(identity().mWords[0]);
 		}
 
-		// Compare slot_functors (equal)
+		// Compare slot_functors (equal): same invoker and same target, word by word
 		bool operator==(const Slot& other) const noexcept
 		{
-			for (size_type index = 0; index < target_size; ++index)
-			{
-				if (mTarget[index] == other.mTarget[index])
-				{
-					return true;
-				}
-			}
-			return false;
+			return mInvoker == other.mInvoker
+				&& std::memcmp(mTarget.data(), other.mTarget.data(), sizeof(mTarget)) == 0;
 		}
 
 		// Compare slot_functors (not equal)
 		bool operator!=(const Slot& other) const noexcept
 		{
-			for (size_type index = 0; index < target_size; ++index)
+			return !(*this == other);
+		}
+
+		// Hash of the identity
+		std::size_t hash() const noexcept
+		{
+			const Identity id = identity();
+			std::uint64_t seed = reinterpret_cast<std::uintptr_t>(id.mInvoker);
+			for (const WordType word : id.mWords)
 			{
-				if (mTarget[index] != other.mTarget[index])
-				{
-					return true;
-				}
+				seed = (seed ^ word) * 0x9E3779B97F4A7C15ull;
+				seed ^= seed >> 29u;
 			}
-			return false;
+			return static_cast<std::size_t>(seed);
 		}
 	};
 
 
 
 	// TEMPLATE CLASS Connection
+	// Node of a plain (non-trackable) connection. Trackable connections use the
+	// bigger TrackableConnection / TrackedConnection nodes, so that the plain
+	// ones carry no weak_ptr and no hooks.
 	template<typename ResT, typename ... ArgTs> class Connection;
 
-	template<typename ReType, typename... Args> class Connection<ReType(Args...)> final
+	template<typename ReType, typename... Args> class Connection<ReType(Args...)>
 	{
 	public:
 		Slot<ReType(Args...)> mSlot;
-		TrackPtr mTrackPtr{ nullptr };
 		std::atomic<Connection<ReType(Args...)>*> mNextPtr{ nullptr };
 		Connection* mDeletedPtr{ nullptr };
-		const bool mTrackable{ false };
-
-	public:
-		// Construct Connection
-		explicit Connection(const Slot<ReType(Args...)>& slot, const TrackPtr& trackPtr, bool trackable) noexcept
+		const bool mTrackable{ false };	// TrackableConnection node
+		const bool mTracked{ false };	// TrackedConnection node
+		bool mRemoved{ false };	// logically removed (written by the writer only)
+		bool mOnce{ false };	// one-shot slot (written before the node is linked)
+		std::atomic<bool> mFired{ false };	// one-shot slot called: dead, unlinked by a writer later
+
+	protected:
+		// Construct Connection (trackable / tracked node)
+		Connection(const Slot<ReType(Args...)>& slot, bool trackable, bool tracked) noexcept
 			: mSlot{ slot }
-			, mTrackPtr{ trackPtr }
 			, mNextPtr{ nullptr }
 			, mDeletedPtr{ nullptr }
 			, mTrackable{ trackable }
+			, mTracked{ tracked }
+			, mRemoved{ false }
+			, mOnce{ false }
+			, mFired{ false }
+		{}
+
+	public:
+		// Construct Connection
+		explicit Connection(const Slot<ReType(Args...)>& slot) noexcept
+			: Connection{ slot, false, false }
 		{}
 
 		// Copy-construct Connection
@@ -231,8 +264,70 @@ namespace JeJo::internal
 		~Connection() noexcept = default;
 	};
 
+	// TEMPLATE CLASS TrackableConnection
+	// Node of a trackable connection: a Connection followed by the tracking pointer
+	template<typename ResT, typename ... ArgTs> class TrackableConnection;
+
+	template<typename ReType, typename... Args> class TrackableConnection<ReType(Args...)> final
+		: public Connection<ReType(Args...)>
+	{
+	public:
+		TrackPtr mTrackPtr{};
+
+	public:
+		// Construct TrackableConnection
+		TrackableConnection(const Slot<ReType(Args...)>& slot, const TrackPtr& trackPtr) noexcept
+			: Connection<ReType(Args...)>{ slot, true, false }
+			, mTrackPtr{ trackPtr }
+		{}
+
+		// Destroy TrackableConnection
+		~TrackableConnection() noexcept = default;
+	};
+
+	// TEMPLATE CLASS TrackedConnection
+	// Node of a connection to a Trackable object: a Connection, hooked into the
+	// list of its Trackable. mPrevPtr is the link pointing to the node in the
+	// Signal's list, so that the Trackable can unlink it without a scan.
+	template<typename ResT, typename ... ArgTs> class TrackedConnection;
+
+	template<typename ReType, typename... Args> class TrackedConnection<ReType(Args...)> final
+		: public Connection<ReType(Args...)>
+		, public TrackHook
+	{
+	public:
+		std::atomic<Connection<ReType(Args...)>*>* mPrevPtr{ nullptr };
+
+	public:
+		// Construct TrackedConnection
+		TrackedConnection(const Slot<ReType(Args...)>& slot, std::atomic<Connection<ReType(Args...)>*>* prevPtr
+			, void* signal, DisconnectFunction disconnect) noexcept
+			: Connection<ReType(Args...)>{ slot, false, true }
+			, TrackHook{ nullptr, nullptr, nullptr, signal, disconnect }
+			, mPrevPtr{ prevPtr }
+		{}
+
+		// Destroy TrackedConnection
+		~TrackedConnection() noexcept = default;
+	};
+
+#if defined(__x86_64__) && defined(__GNUC__)
+	// Node sizes on x86-64 (Itanium ABI), whatever the signature: a layout regression fails the build
+	static_assert(sizeof(Connection<void(int)>) <= 56u, "plain Connection node exceeds 56 bytes");
+	static_assert(sizeof(TrackableConnection<void(int)>) <= 72u, "TrackableConnection node exceeds 72 bytes");
+	static_assert(sizeof(TrackedConnection<void(int)>) <= 104u, "TrackedConnection node exceeds 104 bytes");
+#endif
 }
 
+// Hash of a Slot, for hashed indexes of slots
+template<typename ReType, typename... Args> struct std::hash<JeJo::internal::Slot<ReType(Args...)>>
+{
+	std::size_t operator()(const JeJo::internal::Slot<ReType(Args...)>& slot) const noexcept
+	{
+		return slot.hash();
+	}
+};
+
 #endif // JEJO_SLOT_T_HPP
 
 /*****************************************************************************/
\ No newline at end of file
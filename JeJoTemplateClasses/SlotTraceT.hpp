@@ -0,0 +1,423 @@
+/******************************************************************************
+ * SlotTrace - Process-wide recorder of slot execution spans, exported as
+ * Chrome trace event JSON (chrome://tracing, ui.perfetto.dev) to attribute
+ * emission latency to the slots.
+ *
+ * Built with JEJO_SIGNAL_TRACING defined, Signal::activate() times every slot
+ * invocation (begin / end timestamps, slot identity, Signal) into a ring
+ * buffer of the invoking thread: no lock, no allocation (but the first span
+ * of a thread) and no shared cache line on the emission path. A full ring
+ * overwrites its oldest spans. Emissions of a Signal in real-time mode never
+ * allocate the ring: call SlotTrace::instance().attach_thread() on the
+ * real-time thread beforehand, else its spans are not recorded. Without
+ * JEJO_SIGNAL_TRACING the emission path has no hook at all; the labels and
+ * the export stay available (and empty).
+ *
+ * The spans are named after the labels registered for the slots (label()),
+ * unlabelled slots after their identity hash. Timestamps are CPU ticks
+ * (rdtsc on x86-64) converted to microseconds at export.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_SLOT_TRACE_T_HPP
+#define JEJO_SLOT_TRACE_T_HPP
+
+ // C++ headers
+#include <atomic>		// std::atomic<>
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uint32_t, std::uint64_t
+#include <fstream>		// std::ofstream
+#include <iomanip>		// std::setprecision()
+#include <ios>			// std::ios_base, std::fixed
+#include <memory>		// std::unique_ptr<>
+#include <ostream>		// std::ostream
+#include <string>		// std::string
+#include <unordered_map>// std::unordered_map<>
+#include <utility>		// std::move()
+
+// own JeJo-lib headers
+#include "SlotT.hpp"
+#include "LockClassesT.hpp"
+#include "EmissionTraceT.hpp"	// internal::trace_ticks(), internal::trace_now_ns()
+
+#ifndef JEJO_SLOT_TRACE_CAPACITY
+#define JEJO_SLOT_TRACE_CAPACITY 16384u	// spans kept per thread
+#endif
+
+namespace JeJo
+{
+	class SlotTrace;
+
+	namespace internal
+	{
+		// One slot invocation; atomics, the exporter reads the rings concurrently
+		struct SlotSpanRecord final
+		{
+			std::atomic<std::uint64_t> mBegin{ 0u };
+			std::atomic<std::uint64_t> mEnd{ 0u };
+			std::atomic<std::size_t> mSlot{ 0u };
+			std::atomic<const void*> mSignal{ nullptr };
+		};
+
+		// Ring of the spans of one thread (reused once the thread exits)
+		class SlotTraceBuffer final
+		{
+		private:
+			friend class JeJo::SlotTrace;
+
+			std::unique_ptr<SlotSpanRecord[]> mSpans;
+			std::atomic<std::uint64_t> mHead{ 0u };		// spans written
+			std::atomic<std::uint64_t> mCleared{ 0u };	// spans before it are cleared
+			std::atomic<bool> mInUse{ true };
+			const std::uint32_t mThread;				// "tid" in the export
+			SlotTraceBuffer* mNextBuffer{ nullptr };
+
+		public:
+			// Construct SlotTraceBuffer
+			// May throw exception if memory allocation fails
+			explicit SlotTraceBuffer(std::uint32_t thread)
+				: mSpans{ new SlotSpanRecord[JEJO_SLOT_TRACE_CAPACITY] }
+				, mThread{ thread }
+			{}
+
+			// Append a span; owning thread only. The stores are release ones: the
+			// exporter seeing a span of this lap also sees the head of the lap.
+			void append(std::size_t slot, const void* signal, std::uint64_t begin, std::uint64_t end) noexcept
+			{
+				const std::uint64_t head = mHead.load(std::memory_order_relaxed);
+				SlotSpanRecord& span = mSpans[head % JEJO_SLOT_TRACE_CAPACITY];
+				span.mBegin.store(begin, std::memory_order_release);
+				span.mEnd.store(end, std::memory_order_release);
+				span.mSlot.store(slot, std::memory_order_release);
+				span.mSignal.store(signal, std::memory_order_release);
+				mHead.store(head + 1u, std::memory_order_release);
+			}
+
+			// Release the buffer to the next thread starting
+			void release() noexcept
+			{
+				mInUse.store(false, std::memory_order_release);
+			}
+		};
+
+		// Ring of the calling thread; nullptr until the thread attaches
+		inline thread_local SlotTraceBuffer* slot_trace_buffer = nullptr;
+
+		// Buffer of the calling thread, released when the thread exits
+		class SlotTraceThread final
+		{
+		public:
+			SlotTraceBuffer* const mBuffer;
+
+			// Construct SlotTraceThread: claim a buffer
+			SlotTraceThread();
+
+			// Deleted copy-constructor
+			SlotTraceThread(const SlotTraceThread&) = delete;
+
+			// Deleted copy-assignment operator
+			SlotTraceThread& operator=(const SlotTraceThread&) = delete;
+
+			// Destroy SlotTraceThread: release the buffer
+			~SlotTraceThread() noexcept
+			{
+				if (mBuffer)
+				{
+					slot_trace_buffer = nullptr;
+					mBuffer->release();
+				}
+			}
+		};
+	}
+
+	class SlotTrace final
+	{
+	private:
+		friend class internal::SlotTraceThread;
+
+		std::atomic<internal::SlotTraceBuffer*> mFirstBuffer{ nullptr };
+		std::atomic<std::uint32_t> mThreads{ 0u };
+		std::atomic<bool> mEnabled{ true };
+		mutable internal::SlimLock mLock{};
+		std::unordered_map<std::size_t, std::string> mLabels;	// by slot identity hash
+		const std::uint64_t mStartTicks;
+		const std::uint64_t mStartNs;
+
+		// Construct SlotTrace
+		SlotTrace() noexcept
+			: mStartTicks{ internal::trace_ticks() }
+			, mStartNs{ internal::trace_now_ns() }
+		{}
+
+		// Register the label of a slot identity
+		void label(std::size_t slot, std::string name)
+		{
+			const internal::AutoLock guard{ mLock };
+			mLabels[slot] = std::move(name);
+		}
+
+		// Claim a released buffer or add a new one.
+		// Returns nullptr if memory allocation fails
+		internal::SlotTraceBuffer* acquire() noexcept
+		{
+			for (internal::SlotTraceBuffer* buffer = mFirstBuffer.load(std::memory_order_acquire); buffer; buffer = buffer->mNextBuffer)
+			{
+				bool inUse = false;
+				if (!buffer->mInUse.load(std::memory_order_relaxed)
+					&& buffer->mInUse.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+				{
+					return buffer;
+				}
+			}
+
+			internal::SlotTraceBuffer* buffer = nullptr;
+			try
+			{
+				buffer = new internal::SlotTraceBuffer{ mThreads.fetch_add(1u, std::memory_order_relaxed) + 1u };
+			}
+			catch (...)
+			{
+				return nullptr;
+			}
+			buffer->mNextBuffer = mFirstBuffer.load(std::memory_order_relaxed);
+			while (!mFirstBuffer.compare_exchange_weak(buffer->mNextBuffer, buffer, std::memory_order_release, std::memory_order_relaxed))
+			{
+			}
+			return buffer;
+		}
+
+		// Write a JSON string literal
+		static void write_string(std::ostream& out, const std::string& text)
+		{
+			static constexpr char hex[] = "0123456789abcdef";
+			out << '"';
+			for (const char character : text)
+			{
+				const unsigned char code = static_cast<unsigned char>(character);
+				if (character == '"' || character == '\\')
+				{
+					out << '\\' << character;
+				}
+				else if (code < 0x20u)
+				{
+					out << "\\u00" << hex[code >> 4u] << hex[code & 0xFu];
+				}
+				else
+				{
+					out << character;
+				}
+			}
+			out << '"';
+		}
+
+	public:
+		// Deleted copy-constructor
+		SlotTrace(const SlotTrace&) = delete;
+
+		// Deleted copy-assignment operator
+		SlotTrace& operator=(const SlotTrace&) = delete;
+
+		// The process-wide recorder (never destroyed: threads may trace until the very end)
+		static SlotTrace& instance()
+		{
+			static SlotTrace* const trace = new SlotTrace{};
+			return *trace;
+		}
+
+		// Enable / disable recording (enabled by default)
+		void enable(bool enable = true) noexcept
+		{
+			mEnabled.store(enable, std::memory_order_relaxed);
+		}
+
+		// Check whether recording is enabled
+		bool enabled() const noexcept
+		{
+			return mEnabled.load(std::memory_order_relaxed);
+		}
+
+		// Label a slot: free function / static method
+		// May throw exception if memory allocation fails
+		template<typename ReType, typename... Args>
+		void label(ReType(*function)(Args...), std::string name)
+		{
+			label(internal::Slot<ReType(Args...)>(function).hash(), std::move(name));
+		}
+
+		// Label a slot: method of the object (the Signal has the signature of the method)
+		// May throw exception if memory allocation fails
+		template<typename ClassType, typename ReType, typename... Args>
+		void label(ClassType* object, ReType(ClassType::* method)(Args...), std::string name)
+		{
+			label(internal::Slot<ReType(Args...)>(object, method).hash(), std::move(name));
+		}
+
+		// Label a slot: const method of the object (the Signal has the signature of the method)
+		// May throw exception if memory allocation fails
+		template<typename ClassType, typename ReType, typename... Args>
+		void label(ClassType* object, ReType(ClassType::* method)(Args...) const, std::string name)
+		{
+			label(internal::Slot<ReType(Args...)>(object, method).hash(), std::move(name));
+		}
+
+		// Label a slot: functor connected to a Signal of the signature
+		// May throw exception if memory allocation fails
+		template<typename Signature, typename ClassType>
+		void label(ClassType* functor, std::string name)
+		{
+			label(internal::Slot<Signature>(functor).hash(), std::move(name));
+		}
+
+		// Give the calling thread its ring now (the first span does otherwise),
+		// e.g. before the thread emits Signals in real-time mode.
+		// Returns false if memory allocation fails
+		bool attach_thread() noexcept
+		{
+			static thread_local const internal::SlotTraceThread thread{};
+			return thread.mBuffer != nullptr;
+		}
+
+		// Check whether the calling thread has its ring
+		static bool attached() noexcept
+		{
+			return internal::slot_trace_buffer != nullptr;
+		}
+
+		// Record a span of the slot; calling thread's ring. Drops it if the
+		// thread has no ring and none can be allocated.
+		void record(std::size_t slot, const void* signal, std::uint64_t begin, std::uint64_t end) noexcept
+		{
+			if (internal::slot_trace_buffer || attach_thread())
+			{
+				internal::slot_trace_buffer->append(slot, signal, begin, end);
+			}
+		}
+
+		// Drop the recorded spans
+		void clear() noexcept
+		{
+			for (internal::SlotTraceBuffer* buffer = mFirstBuffer.load(std::memory_order_acquire); buffer; buffer = buffer->mNextBuffer)
+			{
+				buffer->mCleared.store(buffer->mHead.load(std::memory_order_acquire), std::memory_order_relaxed);
+			}
+		}
+
+		// Write the recorded spans as Chrome trace event JSON ("X" events, one
+		// "tid" per thread ring); may run while threads record. Returns the
+		// number of spans written.
+		// May throw exception if the stream does / memory allocation fails
+		std::size_t export_chrome(std::ostream& out) const
+		{
+			const std::uint64_t endTicks = internal::trace_ticks(), endNs = internal::trace_now_ns();
+			const double usPerTick = endTicks > mStartTicks
+				? static_cast<double>(endNs - mStartNs) / static_cast<double>(endTicks - mStartTicks) * 1e-3 : 1e-3;
+
+			std::unordered_map<std::size_t, std::string> labels;
+			{
+				const internal::AutoLock guard{ mLock };
+				labels = mLabels;
+			}
+
+			const std::ios_base::fmtflags flags = out.flags();
+			const std::streamsize precision = out.precision();
+			out << std::fixed << std::setprecision(3);
+
+			std::size_t count = 0u;
+			out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+			for (const internal::SlotTraceBuffer* buffer = mFirstBuffer.load(std::memory_order_acquire); buffer; buffer = buffer->mNextBuffer)
+			{
+				const std::uint64_t head = buffer->mHead.load(std::memory_order_acquire);
+				std::uint64_t first = head > JEJO_SLOT_TRACE_CAPACITY ? head - JEJO_SLOT_TRACE_CAPACITY : 0u;
+				first = first > buffer->mCleared.load(std::memory_order_relaxed) ? first : buffer->mCleared.load(std::memory_order_relaxed);
+
+				for (std::uint64_t index = first; index < head; ++index)
+				{
+					const internal::SlotSpanRecord& record = buffer->mSpans[index % JEJO_SLOT_TRACE_CAPACITY];
+					const std::uint64_t begin = record.mBegin.load(std::memory_order_acquire);
+					const std::uint64_t end = record.mEnd.load(std::memory_order_acquire);
+					const std::size_t slot = record.mSlot.load(std::memory_order_acquire);
+					const void* const signal = record.mSignal.load(std::memory_order_acquire);
+
+					// skip the span if the thread overwrote it meanwhile (or is writing it)
+					if (index + JEJO_SLOT_TRACE_CAPACITY <= buffer->mHead.load(std::memory_order_relaxed))
+					{
+						continue;
+					}
+
+					out << (count++ ? ",\n" : "\n") << "{\"name\":";
+					const auto label = labels.find(slot);
+					write_string(out, label != labels.end() ? label->second : "slot " + std::to_string(slot));
+					out << ",\"cat\":\"slot\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->mThread
+						<< ",\"ts\":" << static_cast<double>(begin > mStartTicks ? begin - mStartTicks : 0u) * usPerTick
+						<< ",\"dur\":" << static_cast<double>(end > begin ? end - begin : 0u) * usPerTick
+						<< ",\"args\":{\"signal\":\"" << signal << "\"}}";
+				}
+			}
+			out << "\n]}\n";
+			out.flags(flags);
+			out.precision(precision);
+			return count;
+		}
+
+		// Write the recorded spans as Chrome trace event JSON into the file.
+		// Returns false if the file cannot be written.
+		// May throw exception if memory allocation fails
+		bool export_chrome(const std::string& path) const
+		{
+			std::ofstream out{ path };
+			export_chrome(out);
+			return static_cast<bool>(out.flush());
+		}
+	};
+
+	namespace internal
+	{
+		// Construct SlotTraceThread: claim a buffer
+		inline SlotTraceThread::SlotTraceThread()
+			: mBuffer{ SlotTrace::instance().acquire() }
+		{
+			slot_trace_buffer = mBuffer;
+		}
+
+		// Times one slot invocation (also when the slot throws)
+		class SlotSpan final
+		{
+		private:
+			const std::size_t mSlot;
+			const void* const mSignal;
+			const std::uint64_t mBegin;
+
+		public:
+			// Construct SlotSpan: the slot starts. A real-time emission only
+			// times the slot if the thread has its ring (no allocation).
+			template<typename Signature>
+			SlotSpan(const Slot<Signature>& slot, const void* signal, bool realtime = false) noexcept
+				: mSlot{ SlotTrace::instance().enabled() && (!realtime || SlotTrace::attached()) ? slot.hash() : 0u }
+				, mSignal{ signal }
+				, mBegin{ mSlot ? trace_ticks() : 0u }
+			{}
+
+			// Deleted copy-constructor
+			SlotSpan(const SlotSpan&) = delete;
+
+			// Deleted copy-assignment operator
+			SlotSpan& operator=(const SlotSpan&) = delete;
+
+			// Destroy SlotSpan: the slot ends
+			~SlotSpan() noexcept
+			{
+				if (mSlot)
+				{
+					SlotTrace::instance().record(mSlot, mSignal, mBegin, trace_ticks());
+				}
+			}
+		};
+	}
+}
+
+#endif // JEJO_SLOT_TRACE_T_HPP
+
+/*****************************************************************************/
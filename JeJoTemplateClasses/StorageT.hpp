@@ -1,6 +1,8 @@
 /******************************************************************************
- * Memory manager for Signal object. Keeps memory blocks to store
-*  Connection<ReType(Args...)> objects. Provides memory allocations / deallocations.
+ * Memory manager for Signal object. Keeps memory blocks (FixedPool<>) to store
+*  Connection<ReType(Args...)> / TrackableConnection<> / TrackedConnection<>
+*  objects (one pool each).
+*  Provides memory allocations / deallocations.
  *
  * @Authur :  JeJo
  * @Date   :  June - 2021
@@ -14,6 +16,11 @@
 
  // C++ headers
 #include <utility>      // std::exchange
+#include <memory>       // std::unique_ptr<>
+#include <type_traits>  // std::is_same_v<>
+
+// own JeJo-lib headers
+#include "PoolAllocatorT.hpp"
 
 namespace JeJo::internal
 {
@@ -24,84 +31,53 @@ namespace JeJo::internal
 	template<typename ReType, typename... Args> class Storage<ReType(Args...)> final
 	{
 	private:
-		Connection<ReType(Args...)>* mBlockPtr;
-		Connection<ReType(Args...)>* mStorePtr;
-		size_type mCapacity;
-
-	private:
-		// Initialize requested memory block
-		void initMemoryBlock(Connection<ReType(Args...)>* address) noexcept
+		using PlainPool = FixedPool<sizeof(Connection<ReType(Args...)>), alignof(Connection<ReType(Args...)>)>;
+		using TrackablePool = FixedPool<sizeof(TrackableConnection<ReType(Args...)>), alignof(TrackableConnection<ReType(Args...)>)>;
+		using TrackedPool = FixedPool<sizeof(TrackedConnection<ReType(Args...)>), alignof(TrackedConnection<ReType(Args...)>)>;
+
+		std::unique_ptr<MmapArena> mArenaPtr; // must outlive the pools
+		PlainPool mPool;
+		TrackablePool mTrackablePool;
+		TrackedPool mTrackedPool;
+
+		// Pool for the node type
+		template<typename NodeType>
+		auto& pool() noexcept
 		{
-			this->mStorePtr = address;
-			Connection<ReType(Args...)>** current = reinterpret_cast<Connection<ReType(Args...)>**>(address);
-
-			for (size_type index = 1u; index < mCapacity; ++index)
+			if constexpr (std::is_same_v<NodeType, TrackableConnection<ReType(Args...)>>)
 			{
-				(*current) = ++address;
-				current = reinterpret_cast<Connection<ReType(Args...)>**>(address);
+				return mTrackablePool;
 			}
-
-			(*current) = nullptr;
-		}
-
-		// Expand memory by allocating new memory block. This May throw exception if memory allocation fails
-		void expandMemory()
-		{
-			Connection<ReType(Args...)>* newMemoryBlock = reinterpret_cast<Connection<ReType(Args...)>*>
-				(NEW_MEMORY(
-					sizeof(Connection<ReType(Args...)>) * mCapacity + 	sizeof(Connection<ReType(Args...)>*)
-				)
-			);
-
-			Connection<ReType(Args...)>** nextMemoryBlock = reinterpret_cast<Connection<ReType(Args...)>**>
-				(mBlockPtr + mCapacity);
-
-			while (*nextMemoryBlock)
+			else if constexpr (std::is_same_v<NodeType, TrackedConnection<ReType(Args...)>>)
 			{
-				nextMemoryBlock = reinterpret_cast<Connection<ReType(Args...)>**>((*nextMemoryBlock) + mCapacity);
+				return mTrackedPool;
 			}
-
-			(*nextMemoryBlock) = newMemoryBlock;
-
-			// initialize the memory block
-			initMemoryBlock(newMemoryBlock);
-			(*reinterpret_cast<Connection<ReType(Args...)>**>(newMemoryBlock + mCapacity)) = nullptr;
-		}
-
-		// Free all allocated memory blocks
-		void clearMemory() noexcept
-		{
-			if (mBlockPtr)
+			else
 			{
-				Connection<ReType(Args...)>* memoryToDelete = (*reinterpret_cast<Connection<ReType(Args...)>**>(mBlockPtr + mCapacity));
-
-				while (memoryToDelete) // while the memoryToDelete is valid
-				{
-					Connection<ReType(Args...)>* block = (*reinterpret_cast<Connection<ReType(Args...)>**>(memoryToDelete + mCapacity));
-					DELETE_MEMORY(memoryToDelete);
-					memoryToDelete = block;
-				}
-
-				DELETE_MEMORY(mBlockPtr);
+				return mPool;
 			}
 		}
 
 	public:
 		// Construct Storage. It may throw exception if memory allocation fails
 		Storage(size_type capacity)
-			: mBlockPtr{ nullptr }
-			, mStorePtr{ nullptr }
-			, mCapacity{ capacity >= 1u ? capacity : 1u }
+			: mArenaPtr{ nullptr }
+			, mPool{ capacity }
+			, mTrackablePool{ capacity }
+			, mTrackedPool{ capacity }
 		{
-			mBlockPtr = reinterpret_cast<Connection<ReType(Args...)>*>(
-				NEW_MEMORY(
-					mCapacity * sizeof(Connection<ReType(Args...)>) + sizeof(Connection<ReType(Args...)>*)
-				)
-			);
-
-			// initialize the memory block
-			initMemoryBlock(mBlockPtr);
-			(*reinterpret_cast<Connection<ReType(Args...)>**>(mBlockPtr + mCapacity)) = nullptr;
+			mPool.reserve();
+		}
+
+		// Construct Storage with its memory blocks in a mmap-backed arena (heap if unavailable).
+		// It may throw exception if memory allocation fails
+		Storage(size_type capacity, const ArenaConfig& config)
+			: mArenaPtr{ std::make_unique<MmapArena>(config) }
+			, mPool{ capacity, mArenaPtr.get() }
+			, mTrackablePool{ capacity, mArenaPtr.get() }
+			, mTrackedPool{ capacity, mArenaPtr.get() }
+		{
+			mPool.reserve();
 		}
 
 		// Copy-construct Storage
@@ -111,50 +87,52 @@ namespace JeJo::internal
 		Storage& operator=(const Storage& other) noexcept = delete;
 
 		// Move-construct Storage
-		Storage(Storage&& other) noexcept
-			: mBlockPtr{ std::exchange(other.mBlockPtr, nullptr) }
-			, mStorePtr{ std::exchange(other.mStorePtr, nullptr) }
-			, mCapacity{ std::exchange(other.mCapacity, 0u) }
-		{}
+		Storage(Storage&& other) noexcept = default;
 
 		// Move-assignment Storage
 		Storage& operator=(Storage&& other) noexcept
 		{
-			clearMemory();
 			if (this != &other)
 			{
-				mBlockPtr = std::exchange(other.mBlockPtr, nullptr);
-				mStorePtr = std::exchange(other.mStorePtr, nullptr);
-				mCapacity = std::exchange(other.mCapacity, 0u);
+				mPool = std::move(other.mPool); // release the old blocks before the old arena
+				mTrackablePool = std::move(other.mTrackablePool);
+				mTrackedPool = std::move(other.mTrackedPool);
+				mArenaPtr = std::move(other.mArenaPtr);
 			}
-
 			return *this;
 		}
 
 		// Destroy Storage
-		~Storage() noexcept
+		~Storage() noexcept = default;
+
+		// Allocate memory for a node (Connection / TrackableConnection / TrackedConnection) from Storage;
+		// It may throw exception if memory allocation fails
+		template<typename NodeType = Connection<ReType(Args...)>>
+		NodeType* allocate()
 		{
-			clearMemory();
+			return static_cast<NodeType*>(pool<NodeType>().allocate());
 		}
 
-		// Allocate memory from Storage; It may throw exception if memory allocation fails
-		Connection<ReType(Args...)>* allocate()
+		// Deallocate previously allocated memory
+		template<typename NodeType>
+		void deallocate(NodeType* address) noexcept
 		{
-			if (!mStorePtr)
-			{
-				expandMemory(); // May throw
-			}
+			pool<NodeType>().deallocate(address);
+		}
 
-			Connection<ReType(Args...)>* current = mStorePtr;
-			mStorePtr = (*reinterpret_cast<Connection<ReType(Args...)>**>(mStorePtr));
-			return current;
+		// Memory statistics: blocks, bytes reserved, nodes in use / free and high-water mark
+		PoolStats stats() const noexcept
+		{
+			PoolStats stats = mPool.stats();
+			stats += mTrackablePool.stats();
+			stats += mTrackedPool.stats();
+			return stats;
 		}
 
-		// Deallocate previously allocated memory
-		void deallocate(Connection<ReType(Args...)>* address) noexcept
+		// Arena of the Storage, nullptr if the Storage uses the heap only
+		const MmapArena* arena() const noexcept
 		{
-			(*reinterpret_cast<Connection<ReType(Args...)>**>(address)) = mStorePtr;
-			mStorePtr = address;
+			return mArenaPtr.get();
 		}
 	};
 
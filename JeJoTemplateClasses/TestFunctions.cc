@@ -1,7 +1,32 @@
 #include <iostream>
 #include <string>
+#include <chrono>
+#include <list>
+#include <map>
+#include <numeric>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <new>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
 
 #include "TestFunctions.hpp"
+#include "LockClassesT.hpp"
+#include "PoolAllocatorT.hpp"
+#include "SignalsT.hpp"
+#include "SignalsLiteT.hpp"
+#include "IpcSignalT.hpp"
+#if JEJO_HAS_MMAP
+#include <sys/wait.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+#include "JeJoAlgorithumsT.hpp"
 // #include "StaticVariantT.hpp"
 
 JEJO_BEGIN
@@ -49,7 +74,729 @@ void static_variant_test()
     //std::cout << s.get<std::string>() << std::endl;
 }
 
+namespace
+{
+    // Milliseconds spent in the callable
+    template<typename Callable>
+    double elapsedMs(Callable&& callable)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        callable();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // One allocator flavour: std::list<>, std::map<> and has_duplicates (std::set<>)
+    template<template<typename> class Alloc>
+    void runNodeContainers(const char* name, std::size_t count, std::size_t rounds)
+    {
+        std::vector<int> values(count);
+        std::iota(values.begin(), values.end(), 0);
+
+        const double listMs = elapsedMs([&] {
+            std::list<int, Alloc<int>> list;
+            for (std::size_t round = 0; round < rounds; ++round)
+            {
+                for (const int value : values) list.push_back(value);
+                while (!list.empty()) list.pop_front();
+            }
+        });
+
+        const double mapMs = elapsedMs([&] {
+            std::map<int, int, std::less<int>, Alloc<std::pair<const int, int>>> map;
+            for (std::size_t round = 0; round < rounds; ++round)
+            {
+                for (const int value : values) map.emplace(value, value);
+                for (const int value : values) map.erase(value);
+            }
+        });
+
+        bool duplicates = false;
+        const double setMs = elapsedMs([&] {
+            for (std::size_t round = 0; round < rounds; ++round)
+            {
+                duplicates |= has_duplicates(values.cbegin(), values.cend(), Alloc<int>{});
+            }
+        });
+
+        std::cout << name << ": list " << listMs << " ms, map " << mapMs
+            << " ms, set (has_duplicates) " << setMs << " ms" << (duplicates ? " !" : "") << '\n';
+    }
+
+    template<typename Type> using SharedPoolAllocator = PoolAllocator<Type, PoolMode::Shared>;
+    template<typename Type> using ThreadLocalPoolAllocator = PoolAllocator<Type, PoolMode::ThreadLocal>;
+}
+
+void poolAllocatorBenchmark()
+{
+    constexpr std::size_t count = 100'000u, rounds = 20u;
+    std::cout << count << " elements x " << rounds << " rounds\n";
+    runNodeContainers<std::allocator>("std::allocator         ", count, rounds);
+    runNodeContainers<SharedPoolAllocator>("PoolAllocator (shared) ", count, rounds);
+    runNodeContainers<ThreadLocalPoolAllocator>("PoolAllocator (thread) ", count, rounds);
+}
+
+#ifdef JEJO_SIGNAL_RT_HOOKS
+namespace
+{
+    struct RtListener final : Trackable
+    {
+        std::atomic<long> mSum{ 0 };
+        void onSample(int& sample) noexcept { mSum.fetch_add(sample, std::memory_order_relaxed); }
+    };
+
+    void rtFreeFunction(int) noexcept {}
+}
+#endif
+
+void realtimeEmitTest()
+{
+#ifdef JEJO_SIGNAL_RT_HOOKS
+    using internal::rt_hook_counters;
+
+    Signal<void(int)> signal;
+    signal.realtime();
+
+    std::vector<RtListener> listeners(64);
+    for (RtListener& listener : listeners)
+    {
+        signal.connect(&listener, &RtListener::onSample);
+    }
+    signal.connect(&rtFreeFunction);
+
+    // weak_ptr-tracked slots which expire before the real-time run: skipped, left for collect()
+    for (int count = 0; count < 16; ++count)
+    {
+        auto expired = std::make_shared<RtListener>();
+        signal.connect(expired, &RtListener::onSample);
+    }
+
+    // the maintenance starts once the real-time thread has met the expired slots
+    std::atomic<bool> started{ false }, stop{ false };
+    std::thread maintenance([&] {
+        RtListener churn;
+        while (!started.load())
+        {
+            std::this_thread::yield();
+        }
+        while (!stop.load())
+        {
+            signal.connect(&churn, &RtListener::onSample);
+            signal.disconnect(&churn, &RtListener::onSample);
+            signal.collect();
+        }
+    });
+
+#ifdef JEJO_SIGNAL_TRACING
+    // the ring of the thread is allocated up front, the real-time run only fills it
+    SlotTrace::instance().attach_thread();
+#endif
+
+    const internal::RtHookCounters before = rt_hook_counters;
+    for (int sample = 0; sample < 200'000; ++sample)
+    {
+        signal(sample);
+        started.store(sample > 1000, std::memory_order_relaxed);
+    }
+    const internal::RtHookCounters after = rt_hook_counters;
+
+    stop.store(true);
+    maintenance.join();
+
+    std::cout << "real-time emit: " << after.mAllocations - before.mAllocations << " allocations, "
+        << after.mDeallocations - before.mDeallocations << " deallocations, "
+        << after.mLocks - before.mLocks << " lock calls -> " << (before == after ? "OK" : "FAILED") << '\n';
+#else
+    std::cout << "real-time emit: build with -DJEJO_SIGNAL_RT_HOOKS\n";
+#endif
+}
+
+namespace
+{
+    struct IpcEvent final
+    {
+        int mIndex;
+        double mValue;
+    };
+
+    // Events received in order by the subscriber process
+    int ipcReceived = 0;
+    bool ipcInOrder = true;
+
+    void onIpcEvent(int index, IpcEvent event)
+    {
+        ipcInOrder &= index == ipcReceived && event.mIndex == index;
+        ++ipcReceived;
+    }
+
+#if JEJO_HAS_MMAP
+    std::vector<int> ipcOvertakenReceived;
+
+    void onIpcOvertaken(int value)
+    {
+        ipcOvertakenReceived.push_back(value);
+    }
+
+    // A publisher stalled between claiming its sequence and its slot, overtaken
+    // meanwhile by the next lap (which dropped its own event), resumes: it must
+    // drop its event too, not rewind the slot under the subscribers.
+    // The ring is set up through a raw mapping (layout of IpcSignalT.hpp: 128
+    // byte header with the head at 64, 64 byte slots led by their state, the
+    // states 4 * sequence + 1 / 2 / 3 for writing / published / dropped).
+    bool ipcOvertakenTest()
+    {
+        const std::string name = "/jejo-ipc-overtaken-test";
+        IpcSignal<void(int)>::remove(name);
+        IpcSignal<void(int)> publisher{ name, 2u, std::chrono::milliseconds(20) };
+
+        const int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        constexpr std::size_t mappingSize = 128u + 2u * 64u;
+        void* const mapping = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (fd < 0 || mapping == MAP_FAILED)
+        {
+            IpcSignal<void(int)>::remove(name);
+            return false;
+        }
+        unsigned char* const ring = static_cast<unsigned char*>(mapping);
+        auto& head = *reinterpret_cast<std::atomic<std::uint64_t>*>(ring + 64u);
+        auto& slot0 = *reinterpret_cast<std::atomic<std::uint64_t>*>(ring + 128u);
+        auto& slot1 = *reinterpret_cast<std::atomic<std::uint64_t>*>(ring + 128u + 64u);
+
+        // a subscriber reading from sequence 2 on
+        head.store(2u);
+        IpcSignal<void(int)> subscriber{ name };
+        subscriber.connect(&onIpcOvertaken);
+        ipcOvertakenReceived.clear();
+
+        // sequence 1 published; sequence 2 gave up on the stalled sequence 0
+        // and marked slot 0 dropped; the publisher of sequence 0 resumes
+        slot1.store(4u * 1u + 2u);
+        slot0.store(4u * 2u + 3u);
+        head.store(0u);
+        const bool resumedDropped = !publisher.emit(-1) && publisher.dropped() == 1u && slot0.load() == 4u * 2u + 3u;
+
+        // sequence 3 (slot 1): the subscriber skips 2, gets 3
+        head.store(3u);
+        const bool published = publisher.emit(3);
+        subscriber.poll();
+        const bool delivered = ipcOvertakenReceived == std::vector<int>{ 3 } && !subscriber.lost();
+
+        ::munmap(mapping, mappingSize);
+        ::close(fd);
+        IpcSignal<void(int)>::remove(name);
+        return resumedDropped && published && delivered;
+    }
+#endif
+}
+
+void ipcSignalTest()
+{
+#if JEJO_HAS_MMAP
+    const std::string name = "/jejo-ipc-signal-test";
+    constexpr int events = 100'000;
+
+    IpcSignal<void(int, IpcEvent)>::remove(name);
+    IpcSignal<void(int, IpcEvent)> publisher{ name, 1u << 17u }; // the ring holds all the events
+
+    int ready[2];
+    if (::pipe(ready) != 0)
+    {
+        std::cout << "IpcSignal: pipe() failed\n";
+        return;
+    }
+
+    const pid_t child = ::fork();
+    if (child == 0)
+    {
+        // subscriber process
+        int status = 1;
+        {
+            IpcSignal<void(int, IpcEvent)> subscriber{ name };
+            subscriber.connect(&onIpcEvent);
+            const char byte = 'r';
+            if (::write(ready[1], &byte, 1) == 1)
+            {
+                while (ipcReceived < events)
+                {
+                    if (!subscriber.poll())
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                status = ipcInOrder && !subscriber.lost() ? 0 : 1;
+            }
+        }
+        ::_exit(status);
+    }
+
+    char byte = 0;
+    const auto elapsed = elapsedMs([&] {
+        if (child > 0 && ::read(ready[0], &byte, 1) == 1)
+        {
+            for (int index = 0; index < events; ++index)
+            {
+                publisher.emit(index, IpcEvent{ index, index * 0.5 });
+            }
+        }
+    });
+
+    int status = -1;
+    if (child > 0)
+    {
+        ::waitpid(child, &status, 0);
+    }
+    ::close(ready[0]);
+    ::close(ready[1]);
+    IpcSignal<void(int, IpcEvent)>::remove(name);
+
+    std::cout << "IpcSignal: " << events << " events to another process in " << elapsed << " ms -> "
+        << (child > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0 ? "OK" : "FAILED") << '\n';
+    std::cout << "IpcSignal: overtaken stalled publisher drops its event -> "
+        << (ipcOvertakenTest() ? "OK" : "FAILED") << '\n';
+#else
+    std::cout << "IpcSignal: needs POSIX shared memory\n";
+#endif
+}
+
+namespace
+{
+    // Clock of the stress test: an emission carries its value at the start, a
+    // disconnector stamps a listener with a later value once disconnect() returns
+    std::atomic<std::uint64_t> stressClock{ 1u };
+    std::atomic<std::uint64_t> stressViolations{ 0u };
+    std::atomic<std::uint64_t> stressCalls{ 0u };
+    std::atomic<std::int64_t> stressTrackedAlive{ 0 };
+
+    struct StressListener final
+    {
+        std::atomic<std::uint64_t> mDisconnectedAt{ 0u };   // 0: connected (or never)
+
+        void onEmit(std::uint64_t epoch) noexcept
+        {
+            const std::uint64_t disconnected = mDisconnectedAt.load();
+            if (disconnected && disconnected <= epoch)
+            {
+                stressViolations.fetch_add(1u);
+            }
+            stressCalls.fetch_add(1u, std::memory_order_relaxed);
+        }
+    };
+
+    struct StressTracked final
+    {
+        static constexpr std::uint64_t alive = 0xA11CE5EEDull;
+        std::atomic<std::uint64_t> mMagic{ alive };
+
+        StressTracked() noexcept { stressTrackedAlive.fetch_add(1); }
+        ~StressTracked() noexcept
+        {
+            mMagic.store(0u);
+            stressTrackedAlive.fetch_sub(1);
+        }
+
+        void onEmit(std::uint64_t) noexcept
+        {
+            if (mMagic.load() != alive)
+            {
+                stressViolations.fetch_add(1u);
+            }
+            stressCalls.fetch_add(1u, std::memory_order_relaxed);
+        }
+    };
+}
+
+bool signalStressTest(std::size_t emitters, std::size_t connectors, std::size_t destroyers, unsigned milliseconds)
+{
+    constexpr std::size_t listenersPerConnector = 16u;
+    constexpr std::size_t trackedPerDestroyer = 8u;
+
+    Signal<void(std::uint64_t)> signal;
+    std::vector<StressListener> listeners(connectors * listenersPerConnector);
+    std::vector<std::vector<std::shared_ptr<StressTracked>>> tracked(destroyers);
+
+    stressViolations.store(0u);
+    stressCalls.store(0u);
+    std::atomic<bool> stop{ false };
+    std::atomic<std::uint64_t> emissions{ 0u }, connections{ 0u }, destructions{ 0u };
+    std::vector<std::thread> threads;
+
+    for (std::size_t index = 0u; index < emitters; ++index)
+    {
+        threads.emplace_back([&] {
+            std::uint64_t count = 0u;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                signal(stressClock.load());
+                ++count;
+            }
+            emissions.fetch_add(count);
+        });
+    }
+
+    for (std::size_t index = 0u; index < connectors; ++index)
+    {
+        threads.emplace_back([&, index] {
+            StressListener* const first = listeners.data() + index * listenersPerConnector;
+            std::vector<bool> connected(listenersPerConnector, false);
+            std::uint64_t count = 0u;
+            std::uint32_t random = 0x9E3779B9u + static_cast<std::uint32_t>(index);
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                random = random * 1664525u + 1013904223u;
+                const std::size_t pick = (random >> 8u) % listenersPerConnector;
+                StressListener& listener = first[pick];
+                if (connected[pick])
+                {
+                    signal.disconnect(&listener, &StressListener::onEmit);
+                    listener.mDisconnectedAt.store(stressClock.fetch_add(1u) + 1u);
+                }
+                else
+                {
+                    listener.mDisconnectedAt.store(0u);
+                    signal.connect(&listener, &StressListener::onEmit);
+                }
+                connected[pick] = !connected[pick];
+                ++count;
+            }
+            for (std::size_t pick = 0u; pick < listenersPerConnector; ++pick)
+            {
+                if (connected[pick])
+                {
+                    signal.disconnect(&first[pick], &StressListener::onEmit);
+                }
+            }
+            connections.fetch_add(count);
+        });
+    }
+
+    for (std::size_t index = 0u; index < destroyers; ++index)
+    {
+        threads.emplace_back([&, index] {
+            std::vector<std::shared_ptr<StressTracked>>& objects = tracked[index];
+            objects.resize(trackedPerDestroyer);
+            std::uint64_t count = 0u;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                // the oldest object goes (its connection expires), a new one connects;
+                // the separately allocated ones may reuse the address of an expired one
+                std::shared_ptr<StressTracked>& object = objects[count % trackedPerDestroyer];
+                object = count % 2u ? std::make_shared<StressTracked>() : std::shared_ptr<StressTracked>(new StressTracked{});
+                if (!signal.connect(object, &StressTracked::onEmit))
+                {
+                    stressViolations.fetch_add(1u); // a new object is never connected already
+                }
+                if (++count % 64u == 0u)
+                {
+                    signal.collect();
+                }
+            }
+            objects.clear();
+            destructions.fetch_add(count);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    stop.store(true);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // every connection is gone: the expired ones are removed, the removed nodes reclaimed
+    signal.collect();
+    signal.collect();
+    const SignalMemoryStats stats = signal.memory_stats();
+    const bool leaked = stats.mConnections != 0u || stats.mStorage.mNodesInUse != 0u
+        || stats.mPendingReclaim_s1 != 0u || stats.mPendingReclaim_s2 != 0u || stressTrackedAlive.load() != 0;
+    const bool passed = stressViolations.load() == 0u && !leaked;
+
+    std::cout << "Signal stress (" << emitters << " emitters, " << connectors << " connectors, "
+        << destroyers << " destroyers, " << seconds << " s): "
+        << static_cast<double>(emissions.load()) / seconds << " emits/s, "
+        << static_cast<double>(stressCalls.load()) / seconds << " slot calls/s, "
+        << static_cast<double>(connections.load()) / seconds << " connects+disconnects/s, "
+        << static_cast<double>(destructions.load()) / seconds << " tracked objects/s; "
+        << stressViolations.load() << " violations, " << (leaked ? "leaked: " : "no leak: ") << stats
+        << " -> " << (passed ? "OK" : "FAILED") << '\n';
+    return passed;
+}
+
+namespace
+{
+    void registryFreeFunction(int) noexcept {}
+}
+
+bool memoryRegistryTest(unsigned milliseconds)
+{
+    // shared with the threads, which are left behind if they deadlock
+    struct State final
+    {
+        std::atomic<bool> mStop{ false };
+        std::atomic<std::uint64_t> mMoves{ 0u };
+        std::atomic<std::uint64_t> mAggregates{ 0u };
+    };
+    const auto state = std::make_shared<State>();
+
+    std::thread mover([state] {
+        Signal<void(int)> signal;
+        signal.connect(&registryFreeFunction);
+        while (!state->mStop.load(std::memory_order_relaxed))
+        {
+            Signal<void(int)> moved{ std::move(signal) };
+            signal = std::move(moved);
+            state->mMoves.fetch_add(1u, std::memory_order_relaxed);
+        }
+    });
+    std::thread aggregator([state] {
+        while (!state->mStop.load(std::memory_order_relaxed))
+        {
+            static_cast<void>(MemoryRegistry::instance().aggregate());
+            state->mAggregates.fetch_add(1u, std::memory_order_relaxed);
+        }
+    });
+
+    // no progress of either thread for a second: deadlock
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+    auto progress = std::chrono::steady_clock::now();
+    std::uint64_t operations = 0u;
+    bool stalled = false;
+    while (!stalled && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        const std::uint64_t current = state->mMoves.load() + state->mAggregates.load();
+        if (current != operations)
+        {
+            operations = current;
+            progress = std::chrono::steady_clock::now();
+        }
+        stalled = std::chrono::steady_clock::now() - progress > std::chrono::seconds(1);
+    }
+
+    state->mStop.store(true);
+    if (stalled)
+    {
+        mover.detach();
+        aggregator.detach();
+    }
+    else
+    {
+        mover.join();
+        aggregator.join();
+    }
+    std::cout << "MemoryRegistry: " << state->mMoves.load() << " Signal moves, " << state->mAggregates.load()
+        << " aggregate() calls" << (stalled ? ", deadlock -> FAILED" : " -> OK") << '\n';
+    return !stalled;
+}
+
+bool emissionTraceTest()
+{
+#if JEJO_HAS_MMAP
+    constexpr int emissions = 10'000;
+    const std::string paths[2]{ "signal_a.trace", "signal_b.trace" };
+    {
+        Signal<void(int)> signals[2];
+        EmissionTrace traces[2]{ EmissionTrace{ paths[0], std::size_t{ 8u } << 20u }, EmissionTrace{ paths[1], std::size_t{ 8u } << 20u } };
+        signals[0].record(&traces[0], 1u);
+        signals[1].record(&traces[1], 2u);
+        for (int emission = 0; emission < emissions; ++emission)
+        {
+            signals[0](emission);
+            signals[1](emission);
+        }
+        signals[0].record(nullptr);
+        signals[1].record(nullptr);
+    } // the trace files are complete
+
+    bool passed = true;
+    for (const std::string& path : paths)
+    {
+        {
+            const EmissionTraceReader reader{ path };
+            std::cout << "EmissionTrace " << path << ": " << reader.records() << " records, "
+                << reader.dropped() << " dropped\n";
+            passed &= reader.records() == static_cast<std::size_t>(emissions) && !reader.dropped();
+        }
+        std::remove(path.c_str());
+    }
+    std::cout << "EmissionTrace: one thread alternating between two traces -> " << (passed ? "OK" : "FAILED") << '\n';
+    return passed;
+#else
+    std::cout << "EmissionTrace: needs mmap()\n";
+    return true;
+#endif
+}
+
+namespace
+{
+    void denseFirstSlot(int) noexcept {}
+    void denseOtherSlot(int) noexcept {}
+}
+
+bool denseSignalHandleTest()
+{
+    // the default (16 bit) IndexType: the generation must not wrap with it
+    ::DenseSignal<void(int)> signal;
+    const auto stale = signal.connect(&denseFirstSlot);
+    signal.disconnect(stale);
+
+    // reuse the handle index of the stale handle 65535 more times
+    for (std::uint32_t reuse = 0u; reuse < 0xFFFFu; ++reuse)
+    {
+        signal.disconnect(signal.connect(&denseOtherSlot));
+    }
+    const auto current = signal.connect(&denseOtherSlot);
+
+    const bool reused = current.m_index == stale.m_index;
+    const bool rejected = !signal.connected(stale) && !signal.disconnect(stale) && signal.connected(current);
+    std::cout << "DenseSignal: handle index reused 65536 times, stale handle "
+        << (rejected ? "rejected" : "accepted") << " -> " << (reused && rejected ? "OK" : "FAILED") << '\n';
+    return reused && rejected;
+}
+
+namespace
+{
+    using RoutingTable = std::map<int, int>;
+
+    // Lookups per second of the reader threads, while one writer changes an entry
+    // of the table every 100 us. read(key) / write(key) access the table.
+    template<typename Read, typename Write>
+    void runReadMostly(const char* name, std::size_t readers, unsigned milliseconds, Read&& read, Write&& write)
+    {
+        std::atomic<bool> stop{ false };
+        std::atomic<std::uint64_t> lookups{ 0u }, updates{ 0u };
+        std::atomic<long> checksum{ 0 };    // keeps the lookups
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t reader = 0u; reader < readers; ++reader)
+        {
+            threads.emplace_back([&, reader] {
+                std::uint64_t count = 0u;
+                long sum = 0;
+                for (int key = static_cast<int>(reader); !stop.load(std::memory_order_relaxed); key = (key + 7) & 255)
+                {
+                    sum += read(key);
+                    ++count;
+                }
+                lookups.fetch_add(count);
+                checksum.fetch_add(sum);
+            });
+        }
+        threads.emplace_back([&] {
+            for (int key = 0; !stop.load(std::memory_order_relaxed); key = (key + 1) & 255)
+            {
+                write(key);
+                updates.fetch_add(1u, std::memory_order_relaxed);
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+        stop.store(true);
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << name << ": " << static_cast<double>(lookups.load()) / seconds << " lookups/s, "
+            << static_cast<double>(updates.load()) / seconds << " updates/s\n";
+    }
+}
+
+void rcuPtrBenchmark(std::size_t readers, unsigned milliseconds)
+{
+    RoutingTable initial;
+    for (int key = 0; key < 256; ++key)
+    {
+        initial.emplace(key, key);
+    }
+    std::cout << "read-mostly table (" << initial.size() << " entries), " << readers << " readers, 1 writer\n";
+
+    {
+        std::shared_mutex mutex;
+        RoutingTable table{ initial };
+        runReadMostly("std::shared_mutex                ", readers, milliseconds
+            , [&](int key) { const std::shared_lock lock{ mutex }; return table.find(key)->second; }
+            , [&](int key) { const std::unique_lock lock{ mutex }; ++table[key]; });
+    }
+
+    {
+        std::atomic<std::shared_ptr<const RoutingTable>> table{ std::make_shared<const RoutingTable>(initial) };
+        runReadMostly("std::atomic<std::shared_ptr<>>   ", readers, milliseconds
+            , [&](int key) { return table.load()->find(key)->second; }
+            , [&](int key) {
+                auto copy = std::make_shared<RoutingTable>(*table.load());
+                ++(*copy)[key];
+                table.store(std::move(copy));
+            });
+    }
+
+    {
+        rcu_ptr<RoutingTable> table{ initial };
+        runReadMostly("rcu_ptr<>                        ", readers, milliseconds
+            , [&](int key) { return table.read()->find(key)->second; }
+            , [&](int key) { table.update([key](RoutingTable& copy) { ++copy[key]; }); });
+    }
+}
+
 #pragma endregion
 
 JEJO_END
 
+#ifdef JEJO_SIGNAL_RT_HOOKS
+// Allocation hooks of the real-time test harness: count every allocation of the thread.
+// All the forms of operator new / delete go through the two functions below, kept out
+// of line: no inlined caller sees a new / free() pair (-Wmismatched-new-delete).
+namespace
+{
+    [[gnu::noinline]] void* rtAllocate(std::size_t size)
+    {
+        JEJO_RT_HOOK(mAllocations);
+        if (void* const address = std::malloc(size ? size : 1u))
+        {
+            return address;
+        }
+        throw std::bad_alloc{};
+    }
+
+    [[gnu::noinline]] void rtFree(void* address) noexcept
+    {
+        if (address)
+        {
+            JEJO_RT_HOOK(mDeallocations);
+        }
+        std::free(address);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return rtAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return rtAllocate(size);
+}
+
+void operator delete(void* address) noexcept
+{
+    rtFree(address);
+}
+
+void operator delete[](void* address) noexcept
+{
+    rtFree(address);
+}
+
+void operator delete(void* address, std::size_t) noexcept
+{
+    rtFree(address);
+}
+
+void operator delete[](void* address, std::size_t) noexcept
+{
+    rtFree(address);
+}
+#endif
+
@@ -40,6 +40,39 @@ constexpr void testReverse(Type last)  noexcept;
 
 void static_variant_test();
 
+// insert / erase timings of node based containers: std::allocator<> vs PoolAllocator<>
+void poolAllocatorBenchmark();
+
+// Signal<> real-time mode: no allocation / lock on the emitting thread, while other
+// threads connect, disconnect and collect(). Needs -DJEJO_SIGNAL_RT_HOOKS.
+void realtimeEmitTest();
+
+// IpcSignal<>: a child process subscribes, the parent publishes, over shared memory
+void ipcSignalTest();
+
+// Signal<> torture: emitters, connectors / disconnectors and destroyers of tracked
+// objects run concurrently for the duration. Fails on a slot called by an emission
+// started after its disconnect() returned, on a call into a destroyed object and on
+// leaked nodes / objects; reports the operations per second.
+bool signalStressTest(std::size_t emitters = 4u, std::size_t connectors = 2u
+    , std::size_t destroyers = 2u, unsigned milliseconds = 2000u);
+
+// MemoryRegistry: one thread moves Signals while another one aggregates their
+// statistics. Fails if they deadlock (no progress for a second).
+bool memoryRegistryTest(unsigned milliseconds = 2000u);
+
+// EmissionTrace: one thread emits alternately on two Signals recording into two
+// traces; fails if records are dropped (each trace keeps its own chunk)
+bool emissionTraceTest();
+
+// DenseSignal<>: a handle of a disconnected slot stays invalid after its index
+// was reused more often than the IndexType counts
+bool denseSignalHandleTest();
+
+// rcu_ptr<> vs std::shared_mutex vs std::atomic<std::shared_ptr<>>: lookups in a
+// read-mostly table by the readers while one writer keeps changing it
+void rcuPtrBenchmark(std::size_t readers = 4u, unsigned milliseconds = 1000u);
+
 
 #pragma endregion
 
@@ -0,0 +1,181 @@
+/******************************************************************************
+ * Trackable - Base class for objects whose slots are connected to many
+ * Signals. Keeps an intrusive list of the object's connections across all
+ * the Signals: destroying the object disconnects exactly its k connections,
+ * without scanning unrelated subscribers, and the Signals invoke these slots
+ * without any liveness check (no weak_ptr::lock() on the emitting thread).
+ *
+ * A method or functor of a (publicly) Trackable-derived class, connected by
+ * raw pointer, is tracked automatically.
+ *
+ * Like Signal::disconnect(), the unlinking does not wait for the emissions in
+ * flight on other threads: destroy the object where no other thread may be
+ * emitting to it (or use the shared_ptr tracking). ~Trackable() runs after the
+ * destructors of the derived classes; call disconnect_tracked() first thing
+ * in the most derived destructor if a slot may run during the destruction.
+ *
+ * @Authur :  JeJo
+ * @Date   :  October - 2026
+ * @license: free to use and distribute(no further support as well)
+ *****************************************************************************/
+
+#ifndef JEJO_TRACKABLE_T_HPP
+#define JEJO_TRACKABLE_T_HPP
+
+ // C++ headers
+#include <cstddef>		// std::size_t
+#include <thread>		// std::this_thread::yield()
+
+// own JeJo-lib headers
+#include "LockClassesT.hpp"
+
+namespace JeJo
+{
+	class Trackable;
+
+	namespace internal
+	{
+		// Link of a tracked connection in the list of its Trackable
+		struct TrackHook
+		{
+			// Disconnect the connection from its Signal, under the lock of the Trackable.
+			// Fails (returns false) if the Signal's write lock is taken.
+			using DisconnectFunction = bool(*)(TrackHook&) noexcept;
+
+			TrackHook* mPrevHook{ nullptr };
+			TrackHook* mNextHook{ nullptr };
+			const Trackable* mOwner{ nullptr };
+			void* mSignal{ nullptr };
+			DisconnectFunction mDisconnectFn{ nullptr };
+		};
+
+		// Access of the Signals to the hook list of a Trackable
+		struct TrackAccess final
+		{
+			// Attach a hook to the Trackable
+			static void attach(const Trackable& owner, TrackHook& hook) noexcept;
+
+			// Detach a hook from its Trackable
+			static void detach(TrackHook& hook) noexcept;
+
+			// Detach a hook from its Trackable, whose lock is held by the caller
+			static void detach_unlocked(TrackHook& hook) noexcept;
+
+			// Lock / unlock the Trackable of the hook
+			static void lock(TrackHook& hook) noexcept;
+			static void unlock(TrackHook& hook) noexcept;
+		};
+	}
+
+	class Trackable
+	{
+	private:
+		friend struct internal::TrackAccess;
+
+		mutable internal::TrackHook* mFirstHook{ nullptr };
+		mutable internal::SlimLock mLock{};
+
+	public:
+		// Construct Trackable
+		Trackable() noexcept = default;
+
+		// Copy-construct Trackable: connections are not copied
+		Trackable(const Trackable&) noexcept
+			: Trackable{}
+		{}
+
+		// Copy-assign Trackable: connections are kept
+		Trackable& operator=(const Trackable&) noexcept
+		{
+			return *this;
+		}
+
+		// Destroy Trackable, disconnect all its tracked connections
+		~Trackable() noexcept
+		{
+			disconnect_tracked();
+		}
+
+		// Disconnect all the tracked connections of the object, from all the Signals
+		void disconnect_tracked() const noexcept
+		{
+			for (;;)
+			{
+				mLock.lock();
+				internal::TrackHook* const hook = mFirstHook;
+				if (!hook)
+				{
+					mLock.unlock();
+					return;
+				}
+
+				// The Signal locks the Trackable while holding its write lock:
+				// only try its lock here, and back off on failure.
+				const bool disconnected = hook->mDisconnectFn(*hook);
+				mLock.unlock();
+				if (!disconnected)
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		// Get number of tracked connections
+		std::size_t tracked() const noexcept
+		{
+			const internal::AutoLock guard{ mLock };
+			std::size_t count = 0;
+			for (const internal::TrackHook* hook = mFirstHook; hook; hook = hook->mNextHook)
+			{
+				++count;
+			}
+			return count;
+		}
+	};
+
+	namespace internal
+	{
+		inline void TrackAccess::attach(const Trackable& owner, TrackHook& hook) noexcept
+		{
+			const AutoLock guard{ owner.mLock };
+			hook.mOwner = &owner;
+			hook.mPrevHook = nullptr;
+			hook.mNextHook = owner.mFirstHook;
+			if (owner.mFirstHook)
+			{
+				owner.mFirstHook->mPrevHook = &hook;
+			}
+			owner.mFirstHook = &hook;
+		}
+
+		inline void TrackAccess::detach(TrackHook& hook) noexcept
+		{
+			const AutoLock guard{ hook.mOwner->mLock };
+			detach_unlocked(hook);
+		}
+
+		inline void TrackAccess::detach_unlocked(TrackHook& hook) noexcept
+		{
+			(hook.mPrevHook ? hook.mPrevHook->mNextHook : hook.mOwner->mFirstHook) = hook.mNextHook;
+			if (hook.mNextHook)
+			{
+				hook.mNextHook->mPrevHook = hook.mPrevHook;
+			}
+			hook.mPrevHook = hook.mNextHook = nullptr;
+		}
+
+		inline void TrackAccess::lock(TrackHook& hook) noexcept
+		{
+			hook.mOwner->mLock.lock();
+		}
+
+		inline void TrackAccess::unlock(TrackHook& hook) noexcept
+		{
+			hook.mOwner->mLock.unlock();
+		}
+	}
+}
+
+#endif // JEJO_TRACKABLE_T_HPP
+
+/*****************************************************************************/
@@ -2,6 +2,7 @@
 #include <vector>
 #include <numeric>
 #include <iomanip>
+#include <map>
 
 // Library headers
 #include "BinarySearchT.hpp"
@@ -9,6 +10,11 @@
 #include "PairExtendedT.hpp"
 // #include "ShapeT.hpp" //@todo: need implementation
 #include "SignalsT.hpp"
+#include "SignalTransactionT.hpp"
+#include "BehaviorSignalT.hpp"
+#include "SignalOperatorsT.hpp"
+#include "RoutedSignalT.hpp"
+#include "EmissionReplayT.hpp"
 #include "VectorExtendedT.hpp"
 #include "GenericVectorT.hpp"
 #include "ForwardCountingIterator.hpp"
@@ -89,6 +95,209 @@ int main()
 #endif
 
 
+#if 0 // Test : PoolAllocatorT<>
+	JeJo::poolAllocatorBenchmark();
+#endif
+
+#if 0 // Test : Signal<> real-time mode (build with -DJEJO_SIGNAL_RT_HOOKS)
+	JeJo::realtimeEmitTest();
+#endif
+
+#if 0 // Test : Signal<> under load (emitters, connectors / disconnectors, tracked object destroyers)
+	JeJo::signalStressTest(4u, 2u, 2u, 5000u);
+#endif
+
+#if 0 // Test : MemoryRegistry (Signals moved while their statistics are aggregated)
+	JeJo::memoryRegistryTest();
+#endif
+
+#if 0 // Test : DenseSignal<> (stale handles after the reuse of their index)
+	JeJo::denseSignalHandleTest();
+#endif
+
+#if 0 // Test : rcu_ptr<> (wait-free reads, copy-on-write updates)
+	{
+		JeJo::rcu_ptr<std::map<std::string, int>> routes{ std::map<std::string, int>{ { "EURUSD", 1 } } };
+		{
+			const auto table = routes.read();		// the value read stays alive for the guard's life
+			routes.update([](std::map<std::string, int>& copy) { copy["USDJPY"] = 2; });
+			std::cout << "read before update: " << table->size() << " routes\n";
+		}
+		std::cout << "read after update: " << routes.read()->size() << " routes\n";
+		routes.synchronize();	// the replaced table is deleted
+	}
+	JeJo::rcuPtrBenchmark();
+#endif
+
+#if 0 // Test : IpcSignal<> (two processes)
+	JeJo::ipcSignalTest();
+#endif
+
+#if 0 // Test : Trackable (its connections to many Signals go away with the object)
+	{
+		struct Listener final : JeJo::Trackable
+		{
+			void onEvent(int arg, std::string str) { std::cout << "Listener: " << arg << " " << str << "\n"; }
+		};
+
+		std::vector<JeJo::Signal<void(int, std::string)>> signals(3);
+		{
+			Listener listener;
+			for (auto& signal : signals)
+			{
+				signal.connect(&listener, &Listener::onEvent);
+			}
+			std::cout << "tracked: " << listener.tracked() << "\n"; // 3
+			signals.front().emit(1, "string");
+		}
+		std::cout << "connected: " << signals.front().size() << "\n"; // 0
+	}
+#endif
+
+#if 0 // Test : BehaviorSignal (a late subscriber gets the latest arguments on connect)
+	{
+		JeJo::BehaviorSignal<void(int, std::string)> state;
+		state.emit(1, "first");
+		state.emit(2, "latest");
+		state.connect(&freeFunction); // called with 2, "latest"
+		if (const auto latest = state.latest())
+		{
+			std::cout << "latest: " << std::get<0>(*latest) << " " << std::get<1>(*latest) << "\n";
+		}
+	}
+#endif
+
+#if 0 // Test : Signal operators (filter / map / sink fused into one slot)
+	{
+		JeJo::Signal<void(int, std::string)> source;
+		const JeJo::Subscription subscription = source
+			| JeJo::filter([](int arg, const std::string&) { return arg > 0; })
+			| JeJo::map([](int arg, const std::string& str) { return str + " #" + std::to_string(arg); })
+			| JeJo::sink([](const std::string& str) { std::cout << "Sink: " << str << "\n"; });
+
+		source.emit(-1, "dropped");
+		source.emit(2, "passed");
+		std::cout << "connected slots: " << source.size() << "\n"; // 1
+	} // the subscription disconnects the chain
+#endif
+
+#if 0 // Test : RoutedSignal (an emission calls the slots of its key and the wildcard ones)
+	{
+		JeJo::RoutedSignal<void(int, std::string)> quotes{ 16u }; // up to 16 keys
+		quotes.connect(7u, &freeFunction);
+		quotes.connect_any(&lmd);
+		quotes.emit(7u, 1, "key 7");		// freeFunction and lmd
+		quotes.emit(8u, 2, "key 8");		// lmd only
+	}
+#endif
+
+#if 0 // Test : Signal<> replicated mode (each emitting thread calls the slots out of its own copy)
+	{
+		JeJo::Signal<void(int, std::string)> hot;
+		hot.replicate();
+		hot.connect(&freeFunction);
+		std::thread other{ [&hot] { hot(1, "other thread"); } };
+		hot(2, "main thread");
+		other.join();
+		hot.connect(&lmd);		// the copies get rebuilt on their next emission
+		hot(3, "main thread");
+	}
+#endif
+
+#if 0 // Test : Signal<> one-shot slots (called by the first emission only)
+	{
+		JeJo::Signal<void(int, std::string)> response;
+		response.connect_once(&freeFunction);
+		response(1, "first");	// freeFunction
+		response(2, "second");	// no slot
+		std::cout << "slots: " << response.size() << "\n";
+	}
+#endif
+
+#if 0 // Test : Signal<> time-budgeted emission (the slots not reached run on the next tick)
+	{
+		JeJo::Signal<void(int, std::string)> frame;
+		frame.connect(&freeFunction);
+		frame.connect(&lmd);
+		for (int tick = 0; tick < 3; ++tick)
+		{
+			if (!frame.resume(std::chrono::microseconds(50))) // the remaining slots of the previous tick first
+			{
+				continue;
+			}
+			frame.emit_within(std::chrono::microseconds(50), tick, "frame");
+		}
+		std::cout << "overruns: " << frame.budget_stats().mOverruns << "\n";
+	}
+#endif
+
+#if 0 // Test : SignalTransaction (one emission per Signal, in dependency order)
+	{
+		JeJo::Signal<void(int, std::string)> width, height, area;
+		width.connect(&freeFunction);
+		height.connect(&freeFunction);
+		area.connect(&lmd);
+
+		JeJo::SignalTransaction transaction;
+		transaction.depends(area, width);
+		transaction.depends(area, height);
+		transaction.emit(area, 2, "area");
+		transaction.emit(width, 1, "width");
+		transaction.emit(height, 2, "height");
+		transaction.emit(area, 2 * 3, "area"); // coalesced with the first one
+		transaction.emit(width, 3, "width");
+		std::cout << transaction.emissions() << " emissions, " << transaction.size() << " to deliver\n";
+	} // commit: width 3, height 2, area 6
+	try
+	{
+		JeJo::Signal<void(int, std::string)> signal;
+		signal.connect(&freeFunction);
+		JeJo::SignalTransaction transaction;
+		transaction.emit(signal, 1, "never");
+		throw std::runtime_error{ "aborted" };
+	}
+	catch (const std::runtime_error&) {} // rollback: nothing emitted
+#endif
+
+#if 0 // Test : EmissionTrace / EmissionReplay (record the emissions, replay them offline)
+	{
+		static constexpr auto replayed = [](int arg, double value) { std::cout << "Replayed: " << arg << " " << value << "\n"; };
+		JeJo::Signal<void(int, double)> signal;
+		signal.connect(&replayed);
+		{
+			JeJo::EmissionTrace trace{ "signal.trace" };
+			signal.record(&trace, 1u);
+			for (int i = 0; i < 3; ++i)
+			{
+				signal(i, i * 0.5);
+			}
+			signal.record(nullptr);
+		} // the trace file is complete
+
+		JeJo::EmissionTraceReader reader{ "signal.trace" };
+		JeJo::EmissionReplay replay;
+		replay.bind(1u, signal);
+		std::cout << replay.run(reader, JeJo::ReplaySpeed::Original) << "\n";
+	}
+	JeJo::emissionTraceTest();	// two traces recorded in turn by one thread
+#endif
+
+#if 0 // Test : SlotTrace (build with -DJEJO_SIGNAL_TRACING, open slots.json in ui.perfetto.dev)
+	{
+		JeJo::Signal<void(int, std::string)> signal;
+		signal.connect(&freeFunction);
+		signal.connect(&lmd);
+		JeJo::SlotTrace::instance().label(&freeFunction, "freeFunction");
+		JeJo::SlotTrace::instance().label<void(int, std::string)>(&lmd, "lmd");
+
+		for (int i = 0; i < 3; ++i)
+		{
+			signal(i, "traced");
+		}
+		JeJo::SlotTrace::instance().export_chrome(std::string{ "slots.json" });
+	}
+#endif
+
 #if 0 // Test : BinarySearchT<>
 	// Test - 1: integers
 	JeJo::BinarySearch<int> Arr0{ 1,  2,  3, 4, 5, 8 };